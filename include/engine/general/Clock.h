@@ -0,0 +1,29 @@
+#ifndef __CLOCK__
+#define __CLOCK__
+
+#include <SDL.h>
+
+// High resolution time, in performance counter ticks
+class Clock
+{
+public:
+  // Current time
+  static Uint64 Now() { return SDL_GetPerformanceCounter(); }
+
+  // Ticks per second
+  static Uint64 GetFrequency();
+
+  static double ToSeconds(Uint64 ticks) { return double(ticks) / GetFrequency(); }
+  static double ToMilliseconds(Uint64 ticks) { return double(ticks) * 1000 / GetFrequency(); }
+  static Uint64 FromSeconds(double seconds) { return Uint64(seconds * GetFrequency()); }
+
+  // Waits until the given time
+  // Sleeps while the OS is expected to wake it up in time, then spins for the rest, so it neither oversleeps by the scheduler's quantum nor burns a core the whole wait
+  static void WaitUntil(Uint64 deadline);
+
+private:
+  // Longest a 1 ms sleep was recently seen to take
+  static Uint64 sleepEstimate;
+};
+
+#endif
@@ -1,86 +1,238 @@
 #ifndef __EVENT__
 #define __EVENT__
 
-#include <unordered_map>
+#include <cstdint>
 #include <functional>
 #include <string>
+#include <memory>
+#include <vector>
+#include <algorithm>
+#include "InlineFunction.h"
 
-class Event
-{
-  typedef std::function<void(void)> functionType;
+// Identifies a listener within the event it was added to. 0 is never issued
+typedef uint32_t ListenerId;
 
+// Keeps a listener subscribed for as long as it lives, and removes it when destroyed
+// It may safely outlive the event it refers to
+class EventSubscription
+{
 public:
-  void AddListener(const std::string &id, functionType callback) { listeners[id] = callback; }
-  void AddOneShotListener(const std::string &id, functionType callback) { listeners[id] = callback; }
-  void CopyListeners(const Event &other)
+  EventSubscription() = default;
+
+  EventSubscription(std::weak_ptr<void> weakAnchor, void (*remove)(void *, ListenerId), ListenerId listenerId)
+      : weakAnchor(weakAnchor), remove(remove), listenerId(listenerId) {}
+
+  EventSubscription(EventSubscription &&other) noexcept { *this = std::move(other); }
+
+  EventSubscription &operator=(EventSubscription &&other) noexcept
   {
-    listeners.insert(other.listeners.begin(), other.listeners.end());
-    oneShotListeners.insert(other.oneShotListeners.begin(), other.oneShotListeners.end());
+    if (this == &other)
+      return *this;
+
+    Cancel();
+
+    weakAnchor = std::move(other.weakAnchor);
+    remove = other.remove;
+    listenerId = other.listenerId;
+    other.weakAnchor.reset();
+
+    return *this;
   }
 
-  void RemoveListener(const std::string &id) { listeners.erase(id); }
+  EventSubscription(const EventSubscription &) = delete;
+  EventSubscription &operator=(const EventSubscription &) = delete;
+
+  ~EventSubscription() { Cancel(); }
 
-  void Invoke()
+  // Removes the listener now
+  void Cancel()
   {
-    for (auto const &entry : listeners)
-      entry.second();
-    for (auto const &entry : oneShotListeners)
-      entry.second();
-    oneShotListeners.clear();
-  }
+    if (auto anchor = weakAnchor.lock())
+      remove(anchor.get(), listenerId);
 
-  int Count() { return listeners.size(); }
+    weakAnchor.reset();
+  }
 
 private:
-  // All listener callbacks subscribed to this event
-  std::unordered_map<std::string, functionType> listeners;
-  std::unordered_map<std::string, functionType> oneShotListeners;
+  // Anchor of the event, which expires with it
+  std::weak_ptr<void> weakAnchor;
+
+  // Removes the listener from the event behind the anchor
+  void (*remove)(void *, ListenerId){nullptr};
+
+  ListenerId listenerId{0};
 };
 
-template <typename T>
-class EventI
+// Event which can be raised with the given arguments
+// Listeners are kept in a dense vector, and invoking never allocates
+// Listeners may be added or removed while the event is being invoked: added ones are only called from the next invocation on
+template <typename... Args>
+class BasicEvent
 {
-  typedef std::function<void(T)> functionType;
+  typedef InlineFunction<void(Args...)> functionType;
 
 public:
-  void AddListener(const std::string &id, functionType callback) { listeners[id] = callback; }
+  BasicEvent() = default;
 
-  void RemoveListener(const std::string &id) { listeners.erase(id); }
+  // Copies get the listeners, but not the subscriptions
+  BasicEvent(const BasicEvent &other) { CopyListeners(other); }
 
-  void Invoke(T value)
+  BasicEvent &operator=(const BasicEvent &other)
   {
-    for (auto const &entry : listeners)
-      entry.second(value);
+    if (this != &other)
+    {
+      listeners.clear();
+      pendingListeners.clear();
+      CopyListeners(other);
+    }
+
+    return *this;
   }
 
-  int Count() { return listeners.size(); }
+  // Adds a listener, returning an id which can be used to remove it
+  ListenerId AddListener(functionType callback) { return Insert(std::move(callback), false); }
 
-private:
-  // All listener callbacks subscribed to this event
-  std::unordered_map<std::string, functionType> listeners;
-};
+  // Adds a listener which is removed after it's first call
+  ListenerId AddOneShotListener(functionType callback) { return Insert(std::move(callback), true); }
 
-template <typename T1, typename T2>
-class EventII
-{
-  typedef std::function<void(T1, T2)> functionType;
+  // Adds a listener which stays subscribed for as long as the returned subscription lives
+  [[nodiscard]] EventSubscription Subscribe(functionType callback)
+  {
+    auto listenerId = AddListener(std::move(callback));
 
-public:
-  void AddListener(const std::string &id, functionType callback) { listeners[id] = callback; }
+    if (anchor == nullptr)
+      anchor = std::make_shared<BasicEvent *>(this);
+
+    auto remove = [](void *anchor, ListenerId listenerId)
+    { (*static_cast<BasicEvent **>(anchor))->RemoveListener(listenerId); };
+
+    return EventSubscription(anchor, remove, listenerId);
+  }
 
-  void RemoveListener(const std::string &id) { listeners.erase(id); }
+  // Adds all of other's listeners to this event, except for the given one
+  void CopyListeners(const BasicEvent &other, ListenerId except = 0)
+  {
+    for (auto otherListeners : {&other.listeners, &other.pendingListeners})
+      for (auto &listener : *otherListeners)
+        if (listener.id != 0 && listener.id != except)
+          Insert(listener.callback, listener.oneShot);
+  }
 
-  void Invoke(T1 value1, T2 value2)
+  void RemoveListener(ListenerId listenerId)
   {
-    for (auto const &entry : listeners)
-      entry.second(value1, value2);
+    if (listenerId == 0)
+      return;
+
+    auto isTarget = [listenerId](const Listener &listener)
+    { return listener.id == listenerId; };
+
+    auto listenerIterator = std::find_if(listeners.begin(), listeners.end(), isTarget);
+
+    if (listenerIterator != listeners.end())
+    {
+      // A listener may be executing right now, so only deactivate it until invocation is over
+      if (invocationDepth > 0)
+        listenerIterator->id = 0;
+      else
+        listeners.erase(listenerIterator);
+
+      return;
+    }
+
+    // Pending ones are never executing
+    pendingListeners.erase(
+        std::remove_if(pendingListeners.begin(), pendingListeners.end(), isTarget), pendingListeners.end());
   }
 
-  int Count() { return listeners.size(); }
+  void Invoke(Args... args)
+  {
+    invocationDepth++;
+
+    // Nothing is inserted in this vector during invocation, so it's size is fixed and it's storage doesn't move
+    for (size_t index = 0; index < listeners.size(); index++)
+    {
+      auto &listener = listeners[index];
+
+      if (listener.id == 0)
+        continue;
+
+      if (listener.oneShot)
+        listener.id = 0;
+
+      listener.callback(args...);
+    }
+
+    if (--invocationDepth == 0)
+      Flush();
+  }
+
+  int Count() const
+  {
+    auto isActive = [](const Listener &listener)
+    { return listener.id != 0; };
+
+    return int(std::count_if(listeners.begin(), listeners.end(), isActive) + pendingListeners.size());
+  }
 
 private:
+  struct Listener
+  {
+    // 0 means it was removed and is waiting to be erased
+    ListenerId id;
+    functionType callback;
+    bool oneShot;
+  };
+
+  ListenerId Insert(functionType callback, bool oneShot)
+  {
+    ListenerId listenerId = nextId++;
+
+    // Don't disturb an ongoing invocation
+    auto &target = invocationDepth > 0 ? pendingListeners : listeners;
+    target.push_back(Listener{listenerId, std::move(callback), oneShot});
+
+    return listenerId;
+  }
+
+  // Erases deactivated listeners and adds pending ones
+  void Flush()
+  {
+    auto isRemoved = [](const Listener &listener)
+    { return listener.id == 0; };
+
+    listeners.erase(std::remove_if(listeners.begin(), listeners.end(), isRemoved), listeners.end());
+
+    for (auto &listener : pendingListeners)
+      listeners.push_back(std::move(listener));
+
+    pendingListeners.clear();
+  }
+
   // All listener callbacks subscribed to this event
-  std::unordered_map<std::string, functionType> listeners;
+  std::vector<Listener> listeners;
+
+  // Listeners added during invocation
+  std::vector<Listener> pendingListeners;
+
+  // How many invocations of this event are currently running
+  int invocationDepth{0};
+
+  // Id for the next listener
+  ListenerId nextId{1};
+
+  // Lets subscriptions know whether this event still exists
+  std::shared_ptr<BasicEvent *> anchor;
 };
 
-#endif
\ No newline at end of file
+// Event without arguments
+typedef BasicEvent<> Event;
+
+// Event with a single argument
+template <typename T>
+using EventI = BasicEvent<T>;
+
+// Event with two arguments
+template <typename T1, typename T2>
+using EventII = BasicEvent<T1, T2>;
+
+#endif
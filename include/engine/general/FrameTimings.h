@@ -0,0 +1,43 @@
+#ifndef __FRAME_TIMINGS__
+#define __FRAME_TIMINGS__
+
+#include <cstddef>
+#include <vector>
+
+// Keeps the durations of the latest frames, to report how evenly they are paced
+class FrameTimings
+{
+public:
+  // Durations of frames, in milliseconds, at a few percentiles
+  struct Percentiles
+  {
+    float p50{0};
+    float p95{0};
+    float p99{0};
+    float max{0};
+  };
+
+  // Keeps up to capacity frames
+  FrameTimings(size_t capacity = 240);
+
+  // Records a frame's duration, in milliseconds
+  void Record(float milliseconds);
+
+  // Percentiles of the kept frames
+  Percentiles GetPercentiles() const;
+
+  // Forgets every frame
+  void Clear();
+
+private:
+  // Ring of durations
+  std::vector<float> durations;
+
+  // Where the next duration goes
+  size_t next{0};
+
+  // How many durations the ring holds
+  size_t count{0};
+};
+
+#endif
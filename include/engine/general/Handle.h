@@ -0,0 +1,121 @@
+#ifndef __HANDLE__
+#define __HANDLE__
+
+#include <cstdint>
+#include <vector>
+#include <deque>
+#include "Helper.h"
+
+// A 32 bit reference to an entry of a HandleTable
+// The lower bits index the table's slot, the upper bits hold the generation the slot had when the handle was issued
+// When the entry is removed the slot's generation changes, so every handle still pointing to it resolves to nullptr
+struct Handle
+{
+  // How many bits of the value are used for the slot index
+  static const uint32_t indexBits{20};
+
+  // Masks for each part of the value
+  static const uint32_t indexMask{(1u << indexBits) - 1};
+  static const uint32_t generationMask{(1u << (32 - indexBits)) - 1};
+
+  Handle() = default;
+  Handle(uint32_t index, uint32_t generation) : value((generation << indexBits) | index) {}
+
+  uint32_t GetIndex() const { return value & indexMask; }
+  uint32_t GetGeneration() const { return value >> indexBits; }
+
+  // Whether this handle was never assigned to anything
+  bool IsNull() const { return value == 0; }
+  explicit operator bool() const { return IsNull() == false; }
+
+  bool operator==(const Handle &other) const { return value == other.value; }
+  bool operator!=(const Handle &other) const { return value != other.value; }
+
+  // Packed index & generation. Generation 0 is never issued, so 0 is always the null handle
+  uint32_t value{0};
+};
+
+// Slot map which hands out generation checked handles to raw pointers
+// Resolving a handle is an index plus a comparison, with no reference counting involved
+// It does not own the pointers: owners must insert themselves on construction and remove themselves on destruction
+template <class T>
+class HandleTable
+{
+public:
+  // Stores the pointer in a free slot and returns a handle to it
+  Handle Insert(T *pointer)
+  {
+    uint32_t index;
+
+    // Only reuse slots once enough of them are free, so that a single slot doesn't run through it's generations too fast
+    if (freeSlots.size() > minFreeSlots)
+    {
+      index = freeSlots.front();
+      freeSlots.pop_front();
+    }
+    else
+    {
+      Helper::Assert(slots.size() <= Handle::indexMask, "Handle table ran out of slots");
+
+      index = slots.size();
+      slots.emplace_back();
+    }
+
+    slots[index].pointer = pointer;
+    count++;
+
+    return Handle(index, slots[index].generation);
+  }
+
+  // Frees the handle's slot. Any copies of this handle will stop resolving
+  void Remove(Handle handle)
+  {
+    if (Get(handle) == nullptr)
+      return;
+
+    auto &slot = slots[handle.GetIndex()];
+
+    slot.pointer = nullptr;
+
+    // Advance generation, skipping 0
+    slot.generation = slot.generation % Handle::generationMask + 1;
+
+    freeSlots.push_back(handle.GetIndex());
+    count--;
+  }
+
+  // Gets the pointer this handle refers to, or nullptr if it's no longer valid
+  T *Get(Handle handle) const
+  {
+    uint32_t index = handle.GetIndex();
+
+    if (index >= slots.size())
+      return nullptr;
+
+    auto &slot = slots[index];
+
+    return slot.generation == handle.GetGeneration() ? slot.pointer : nullptr;
+  }
+
+  // How many entries are currently stored
+  size_t Count() const { return count; }
+
+private:
+  struct Slot
+  {
+    T *pointer{nullptr};
+    uint32_t generation{1};
+  };
+
+  // How many free slots to accumulate before starting to reuse them
+  static const size_t minFreeSlots{1024};
+
+  std::vector<Slot> slots;
+
+  // Indices of free slots, oldest first
+  std::deque<uint32_t> freeSlots;
+
+  size_t count{0};
+};
+
+#endif
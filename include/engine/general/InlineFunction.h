@@ -0,0 +1,151 @@
+#ifndef __INLINE_FUNCTION__
+#define __INLINE_FUNCTION__
+
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+template <typename Signature>
+class InlineFunction;
+
+// Type erased callable, like std::function, but which stores small callables (such as lambdas with a few captures) inside itself
+// Only callables that don't fit the inline buffer are allocated on the heap
+// Calling it never allocates
+template <typename Return, typename... Args>
+class InlineFunction<Return(Args...)>
+{
+public:
+  // How many bytes of callable can be stored without allocating
+  static const size_t capacity{6 * sizeof(void *)};
+
+  InlineFunction() = default;
+
+  template <typename Callable, typename = std::enable_if_t<std::is_same_v<std::decay_t<Callable>, InlineFunction> == false>>
+  InlineFunction(Callable &&callable)
+  {
+    typedef std::decay_t<Callable> Stored;
+
+    if constexpr (FitsInline<Stored>())
+    {
+      new (storage) Stored(std::forward<Callable>(callable));
+      operations = &InlineOperations<Stored>::table;
+    }
+    else
+    {
+      new (storage) Stored *(new Stored(std::forward<Callable>(callable)));
+      operations = &HeapOperations<Stored>::table;
+    }
+  }
+
+  InlineFunction(const InlineFunction &other) : operations(other.operations)
+  {
+    if (operations != nullptr)
+      operations->copy(storage, other.storage);
+  }
+
+  InlineFunction(InlineFunction &&other) noexcept : operations(other.operations)
+  {
+    if (operations != nullptr)
+      operations->move(storage, other.storage);
+  }
+
+  InlineFunction &operator=(const InlineFunction &other)
+  {
+    if (this != &other)
+    {
+      Reset();
+      if (other.operations != nullptr)
+        other.operations->copy(storage, other.storage);
+      operations = other.operations;
+    }
+
+    return *this;
+  }
+
+  InlineFunction &operator=(InlineFunction &&other) noexcept
+  {
+    if (this != &other)
+    {
+      Reset();
+      if (other.operations != nullptr)
+        other.operations->move(storage, other.storage);
+      operations = other.operations;
+    }
+
+    return *this;
+  }
+
+  ~InlineFunction() { Reset(); }
+
+  Return operator()(Args... args) const { return operations->invoke(storage, std::forward<Args>(args)...); }
+
+  explicit operator bool() const { return operations != nullptr; }
+
+  // Destroys the stored callable
+  void Reset()
+  {
+    if (operations != nullptr)
+      operations->destroy(storage);
+
+    operations = nullptr;
+  }
+
+private:
+  // Functions which know how to handle the stored callable's type
+  struct Operations
+  {
+    Return (*invoke)(void *storage, Args &&...args);
+    void (*copy)(void *destination, const void *source);
+    void (*move)(void *destination, void *source);
+    void (*destroy)(void *storage);
+  };
+
+  template <typename Stored>
+  static constexpr bool FitsInline()
+  {
+    return sizeof(Stored) <= capacity &&
+           alignof(std::max_align_t) % alignof(Stored) == 0 &&
+           std::is_nothrow_move_constructible_v<Stored>;
+  }
+
+  // Operations for callables stored in the buffer
+  template <typename Stored>
+  struct InlineOperations
+  {
+    static Stored &Get(void *storage) { return *static_cast<Stored *>(storage); }
+
+    static Return Invoke(void *storage, Args &&...args) { return Get(storage)(std::forward<Args>(args)...); }
+    static void Copy(void *destination, const void *source) { new (destination) Stored(Get(const_cast<void *>(source))); }
+    static void Move(void *destination, void *source) { new (destination) Stored(std::move(Get(source))); }
+    static void Destroy(void *storage) { Get(storage).~Stored(); }
+
+    static constexpr Operations table{Invoke, Copy, Move, Destroy};
+  };
+
+  // Operations for callables which live in the heap, with the buffer holding their pointer
+  template <typename Stored>
+  struct HeapOperations
+  {
+    static Stored *&Get(void *storage) { return *static_cast<Stored **>(storage); }
+
+    static Return Invoke(void *storage, Args &&...args) { return (*Get(storage))(std::forward<Args>(args)...); }
+    static void Copy(void *destination, const void *source) { new (destination) Stored *(new Stored(*Get(const_cast<void *>(source)))); }
+    static void Move(void *destination, void *source)
+    {
+      new (destination) Stored *(Get(source));
+      Get(source) = nullptr;
+    }
+    static void Destroy(void *storage) { delete Get(storage); }
+
+    static constexpr Operations table{Invoke, Copy, Move, Destroy};
+  };
+
+  // Where the callable (or a pointer to it) is stored
+  alignas(std::max_align_t) mutable unsigned char storage[capacity];
+
+  // Operations for the stored callable's type, or nullptr if empty
+  const Operations *operations{nullptr};
+};
+
+#endif
@@ -47,8 +47,8 @@ private:
   // Maps controller id to a timer
   static std::unordered_map<int, Timer> controllerCooldowns;
 
-  // Callback identifier
-  std::string callbackIdentifier;
+  // Keeps controller input listeners subscribed
+  std::vector<EventSubscription> inputSubscriptions;
 };
 
 #endif
\ No newline at end of file
@@ -2,6 +2,7 @@
 #define __UI_IMAGE__
 
 #include "UIContent.h"
+#include "Resources.h"
 
 // A UI Object which can contain children UI Objects
 class UIImage : public UIContent
@@ -31,15 +32,15 @@ public:
   float GetScaling(UIDimension::Axis axis = UIDimension::Horizontal);
 
 private:
-  // Allows a procedure to operate with a texture from image with color alterations already applied to it
-  void UseTexture(std::function<void(SDL_Texture *)> procedure);
-
-  // Loads texture dimensions from the current imagePath
+  // Loads texture dimensions from the current image
   void ReloadTextureDimensions();
 
   // Which image to show
   std::string imagePath;
 
+  // The loaded image, held so the cache can't evict it while it's shown
+  std::shared_ptr<TextureAtlas::Region> image;
+
   // Original real pixel width of the loaded texture
   int textureWidth;
 
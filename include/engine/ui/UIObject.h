@@ -92,7 +92,8 @@ public:
   Vector2 localScale{1, 1};
 
 protected:
-  std::string callbackIdentifier;
+  // Keeps the canvas root subscribed to mouse clicks
+  EventSubscription clickSubscription;
 
 private:
   // Gives all dimensions this object's shared pointer
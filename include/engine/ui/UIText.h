@@ -3,6 +3,7 @@
 
 #include "UIContent.h"
 #include "Color.h"
+#include "GlyphAtlas.h"
 #include <SDL_ttf.h>
 #include <SDL_image.h>
 #include <memory>
@@ -24,34 +25,28 @@ public:
   // Gets current text content
   std::string GetText();
 
-  // Is the size of the text texture
+  // Is the size of the laid out text
   int GetContentRealPixelsAlong(
       UIDimension::Axis axis,
       UIDimension::Calculation config = UIDimension::Calculation::Default) override;
 
 private:
-  // Recreates the main texture, applying a border
-  void RemakeTexture();
-
-  // Gets a simple texture for the current text, with the specified color
-  auto_unique_ptr<SDL_Texture> GetTextureWithColor(Color targetColor);
+  // Gets the current font's glyphs and measures the text with them
+  void Layout();
 
   // Which text to show
   std::string text;
 
-  // Texture of text
-  auto_unique_ptr<SDL_Texture> mainTexture;
+  // Glyphs of the current font
+  std::shared_ptr<GlyphAtlas> glyphAtlas;
 
-  // Quick access to texture width
+  // Quick access to text width, border included
   int pixelWidth{0};
 
-  // Quick access to texture height
+  // Quick access to text height, border included
   int pixelHeight{0};
 
-  // Format to use when creating textures
-  Uint32 textureFormat;
-
-  // Whether to remake texture next frame
+  // Whether to lay text out again next frame
   bool forceRemake{false};
 };
 
@@ -0,0 +1,74 @@
+#ifndef __ASSET_ARCHIVE__
+#define __ASSET_ARCHIVE__
+
+#include <string>
+#include <cstdint>
+#include <SDL.h>
+
+// Assets packed into a single file, which is memory mapped and looked up through an index sorted by path hash
+// Streams over packed assets read the mapped bytes in place, without copying them. Images may be packed already decoded, skipping their decode entirely
+// Assets missing from the archive (or every asset, if no archive is open) are read from their loose files
+// Once opened, the archive stays mapped until the program exits, as streamed music and fonts keep reading from it
+class AssetArchive
+{
+public:
+  // Where the archive is packed to & opened from by default
+  static const std::string defaultPath;
+
+  // Maps the archive. Returns whether it was found & valid
+  static bool Open(std::string path = defaultPath);
+
+  static bool IsOpen();
+
+  // Opens a stream over the asset, from the archive if it's packed there or from it's loose file otherwise
+  // Returns nullptr if it's in neither
+  static SDL_RWops *OpenStream(std::string filename);
+
+  // Loads the asset's pixels. Pixels packed already decoded are not copied, so the surface may only be read from
+  static SDL_Surface *LoadSurface(std::string filename);
+
+  // Packs every file under the directory into a new archive at the given path
+  // Images are stored decoded when decodeImages is set, trading archive size for load time
+  static void Pack(std::string directory, std::string path = defaultPath, bool decodeImages = true);
+
+private:
+  // Fixed size start of the archive
+  struct Header
+  {
+    char magic[4];
+    uint32_t version;
+    uint32_t entryCount;
+    uint32_t reserved;
+  };
+
+  // Locates one asset in the archive. Entries follow the header, sorted by hash
+  struct Entry
+  {
+    uint64_t hash;
+
+    // Position & size of it's bytes
+    uint64_t offset;
+    uint64_t size;
+
+    // Position & length of it's path, to tell apart colliding hashes
+    uint32_t nameOffset;
+    uint32_t nameLength;
+
+    // Dimensions of it's pixels, if it's an image stored decoded (0 otherwise)
+    uint32_t width;
+    uint32_t height;
+  };
+
+  // Whether the mapped file is an archive whose every entry lies within it
+  static bool IsValid(const uint8_t *data, size_t size);
+
+  // Paths are looked up without a leading ./ and with forward slashes
+  static std::string Normalize(std::string filename);
+
+  static uint64_t Hash(const std::string &normalizedFilename);
+
+  // Finds the asset in the archive (nullptr if it's not there)
+  static const Entry *Find(std::string filename);
+};
+
+#endif
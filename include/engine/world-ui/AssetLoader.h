@@ -0,0 +1,125 @@
+#ifndef __ASSET_LOADER__
+#define __ASSET_LOADER__
+
+#include <atomic>
+#include <deque>
+#include <memory>
+#include <string>
+#include <vector>
+#include <SDL.h>
+#include <SDL_mixer.h>
+
+class AssetLoader;
+
+// Handle to an asset being loaded in the background
+// Once ready, getting the asset from Resources returns it without any loading
+class AssetRequest
+{
+  friend class AssetLoader;
+  friend class Resources;
+
+public:
+  enum class Type
+  {
+    Image,
+    Sound,
+    Music
+  };
+
+  enum class State
+  {
+    // Waiting for a worker
+    Queued,
+    // Being decoded by a worker
+    Decoding,
+    // Decoded, waiting to be stored in Resources by the main thread
+    Decoded,
+    // Stored in Resources
+    Ready,
+    Failed
+  };
+
+  AssetRequest(Type type, std::string filename);
+
+  // Frees decoded data which never made it to Resources
+  ~AssetRequest();
+
+  const Type type;
+
+  const std::string filename;
+
+  State GetState() const { return state; }
+
+  // Whether the asset can be got from Resources without any loading
+  bool IsReady() const { return state == State::Ready; }
+
+  // Whether the request will no longer change
+  bool IsDone() const { return state == State::Ready || state == State::Failed; }
+
+  // How many bytes of pixels must be uploaded to store it (0 for audio)
+  size_t GetUploadSize() const;
+
+private:
+  std::atomic<State> state{State::Queued};
+
+  // === DECODED DATA
+
+  SDL_Surface *surface{nullptr};
+  Mix_Chunk *chunk{nullptr};
+  Mix_Music *music{nullptr};
+};
+
+// Decodes image & audio files on a pool of worker threads
+// Decoding needs no renderer, so it's safe off the main thread. Storing the decoded data (which uploads images to the atlas) is left to Resources, on the main thread
+class AssetLoader
+{
+public:
+  // With no workers, requests are decoded as soon as they are enqueued
+  AssetLoader(int workerCount);
+
+  // Stops the workers, then drops every request it still holds
+  ~AssetLoader();
+
+  // Queues the request to be decoded
+  void Enqueue(std::shared_ptr<AssetRequest> request);
+
+  // Takes the oldest request which finished decoding (nullptr if none)
+  std::shared_ptr<AssetRequest> TakeDecoded();
+
+  // Blocks until the request is decoded. If no worker picked it up yet, it's decoded on the calling thread
+  void Wait(const std::shared_ptr<AssetRequest> &request);
+
+  // Drops the requests waiting for a worker and those decoded but not taken
+  // A request's decoded data is freed once nothing else holds it, so Resources must drop it's references too
+  void Cancel();
+
+  // Worker count which leaves a core for the main thread and one for the render thread
+  static int GetDefaultWorkerCount();
+
+private:
+  // Loop of each worker
+  static int Work(void *loader);
+
+  // Reads the file into the request's decoded data
+  static void Decode(AssetRequest &request);
+
+  // Requests waiting for a worker
+  std::deque<std::shared_ptr<AssetRequest>> queued;
+
+  // Requests which finished decoding, in the order they finished
+  std::deque<std::shared_ptr<AssetRequest>> decoded;
+
+  // === THREADING
+
+  std::vector<SDL_Thread *> workers;
+
+  // Guards the queues & stopRequested
+  SDL_mutex *mutex{nullptr};
+
+  // Signals new requests to workers & finished requests to waiters
+  SDL_cond *condition{nullptr};
+
+  bool stopRequested{false};
+};
+
+#endif
@@ -0,0 +1,46 @@
+#ifndef __ASSET_MANIFEST__
+#define __ASSET_MANIFEST__
+
+#include <set>
+#include <string>
+#include <utility>
+#include <SDL.h>
+
+// Lists the assets a scene uses, so they can be loaded before it starts
+class AssetManifest
+{
+public:
+  // A clip of an image
+  struct SpriteClip
+  {
+    std::string filename;
+    SDL_Rect clip;
+
+    bool operator<(const SpriteClip &other) const;
+  };
+
+  std::set<std::string> images;
+  std::set<std::string> sounds;
+  std::set<std::string> music;
+
+  // Filename & size
+  std::set<std::pair<std::string, int>> fonts;
+
+  std::set<SpriteClip> sprites;
+
+  // Adds every asset of the other manifest to this one
+  void Merge(const AssetManifest &other);
+
+  // How many assets are listed
+  size_t Count() const;
+
+  void Clear();
+
+  // Reads a manifest written by Save. Gives an empty manifest if the file doesn't exist
+  static AssetManifest Load(std::string path);
+
+  // Writes one asset per line. Returns whether it succeeded
+  bool Save(std::string path) const;
+};
+
+#endif
@@ -19,6 +19,9 @@ public:
 
   static const float initialSize;
 
+  // How far beyond it's view, in units, things are still considered to be visible
+  static const float cullingMargin;
+
   Camera(GameObject &associatedObject);
 
   virtual ~Camera() {}
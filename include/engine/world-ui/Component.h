@@ -56,6 +56,14 @@ public:
   // Component's unique identifier
   const int id;
 
+  // Generation checked handle to this component, which stops resolving once it's destroyed
+  const Handle handle;
+
+  // Gets the component a handle refers to, or nullptr if it no longer exists
+  // T must be the component's actual class or one of it's bases
+  template <class T = Component>
+  static T *Resolve(Handle target) { return static_cast<T *>(handleTable.Get(target)); }
+
 protected:
   virtual void Awake() {}
   virtual void Start() {}
@@ -88,6 +96,9 @@ private:
 
   // Whether Start has been called already
   bool started{false};
+
+  // Table which issues all component handles
+  static HandleTable<Component> handleTable;
 };
 
 std::ostream &operator<<(std::ostream &stream, const Component &vector);
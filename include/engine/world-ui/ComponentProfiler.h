@@ -0,0 +1,117 @@
+#ifndef __COMPONENT_PROFILER__
+#define __COMPONENT_PROFILER__
+
+#include <array>
+#include <ostream>
+#include <string>
+#include <typeindex>
+#include <typeinfo>
+#include <unordered_map>
+#include <vector>
+#include <SDL.h>
+#include "Clock.h"
+#include "BuildConfigurations.h"
+
+// Times the enclosing scope as a call of the given phase on the object's concrete type. Compiles to nothing unless PROFILE_COMPONENTS is defined
+#ifdef PROFILE_COMPONENTS
+#define PROFILE_COMPONENT_JOIN(first, second) first##second
+#define PROFILE_COMPONENT_NAME(line) PROFILE_COMPONENT_JOIN(componentTimer, line)
+#define PROFILE_COMPONENT(object, phase) ComponentTimer PROFILE_COMPONENT_NAME(__LINE__)(typeid(object), ComponentProfiler::Phase::phase)
+#else
+#define PROFILE_COMPONENT(object, phase)
+#endif
+
+// Adds up how many times each concrete component (or renderable) type had each of it's phases called, and for how long
+// Phases are only ever called from the main thread, so no locking is done
+class ComponentProfiler
+{
+public:
+  enum class Phase
+  {
+    Start,
+    Update,
+    PhysicsUpdate,
+    Render,
+    // Collision & trigger callbacks
+    Collision
+  };
+
+  static const size_t phaseCount{5};
+
+  // Cost of one phase of one type
+  struct PhaseStats
+  {
+    size_t calls{0};
+
+    // Time spent in the calls, including phases of other types they called into
+    Uint64 totalTicks{0};
+
+    // Time spent in the calls, minus phases of other types they called into
+    Uint64 selfTicks{0};
+  };
+
+  // Cost of every phase of one type
+  struct TypeStats
+  {
+    std::string typeName;
+
+    std::array<PhaseStats, phaseCount> phases;
+
+    Uint64 GetSelfTicks() const;
+  };
+
+  // Adds a call to the type's phase
+  static void Record(const std::type_info &type, Phase phase, Uint64 totalTicks, Uint64 selfTicks);
+
+  // Stats of every type recorded since the last reset, costliest self time first
+  static std::vector<TypeStats> GetStats();
+
+  // Forgets every recorded call
+  static void Reset();
+
+  // Writes the stats as a table, in milliseconds
+  static void PrintTable(std::ostream &stream);
+
+  // Writes the stats as CSV, with a row per type & phase. Returns whether it was written
+  static bool ExportCsv(std::string path);
+
+  static const char *GetPhaseName(Phase phase);
+
+private:
+  // Readable name of the type
+  static std::string GetTypeName(const std::type_info &type);
+
+  static std::unordered_map<std::type_index, TypeStats> stats;
+};
+
+// Records the time from it's construction to it's destruction as a call to the type's phase
+// Time spent in timers opened meanwhile is kept out of this one's self time
+class ComponentTimer
+{
+public:
+  ComponentTimer(const std::type_info &type, ComponentProfiler::Phase phase)
+      : type(type), phase(phase), parent(current), start(Clock::Now()) { current = this; }
+
+  ~ComponentTimer();
+
+  ComponentTimer(const ComponentTimer &) = delete;
+  ComponentTimer &operator=(const ComponentTimer &) = delete;
+
+private:
+  const std::type_info &type;
+
+  ComponentProfiler::Phase phase;
+
+  // Timer this one was opened inside of
+  ComponentTimer *parent;
+
+  Uint64 start;
+
+  // Time spent in timers opened inside this one
+  Uint64 childTicks{0};
+
+  // Innermost open timer
+  static ComponentTimer *current;
+};
+
+#endif
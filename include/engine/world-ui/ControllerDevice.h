@@ -62,6 +62,9 @@ private:
   // Which player is associated to this controller
   std::weak_ptr<Player> weakAssociationPlayer;
 
+  // Keeps this controller listening to the player manager's searches
+  EventSubscription playerManagerSubscription;
+
   // Stores the game controller SDL struct of this controller
   const Helper::auto_unique_ptr<SDL_GameController> controllerStruct;
 
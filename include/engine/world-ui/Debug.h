@@ -6,6 +6,8 @@
 #include "Rectangle.h"
 #include "Color.h"
 
+// Draws debug primitives on top of the frame
+// Drawings are queued in world coordinates and grouped by color, then converted to the screen and recorded all at once when the frame is flushed
 class Debug
 {
 public:
@@ -24,6 +26,9 @@ public:
   // Draws a line with an arrow, given it's global start and end positions in game units
   // Allows setting head size in units
   static void DrawArrow(Vector2 start, Vector2 end, Color color = Color::Green(), float headSize = 1, float headArcAngle = M_PI / 2);
+
+  // Records every queued drawing in the frame's command list with a single points and a single lines command per color, then clears the queue
+  static void Flush();
 };
 
 #endif
\ No newline at end of file
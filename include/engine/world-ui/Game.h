@@ -3,12 +3,22 @@
 
 #include <SDL.h>
 #include <memory>
+#include <cstdint>
 #include <stack>
 #include "Helper.h"
 #include "InputManager.h"
+#include "SpriteBatch.h"
+#include "RenderContext.h"
+#include "RenderThread.h"
+#include "AssetLoader.h"
+#include "AssetManifest.h"
+#include "HeadlessOptions.h"
+#include "Clock.h"
+#include "FrameTimings.h"
 #include "BuildConfigurations.h"
 
 class GameScene;
+class VoiceManager;
 
 // Class with the main game logic
 class Game
@@ -34,23 +44,48 @@ public:
   // Path to engine's default font
   static const std::string defaultFontPath;
 
+  // How to run without a window. Must be set before the instance is created
+  static HeadlessOptions headlessOptions;
+
   // === FUNCTIONS
 
   // Gets the game instance if it exists or creates one if it doesn't
   static Game &GetInstance();
 
+  // Destroys the game instance, if it exists
+  // Must be called before main returns, as the game's teardown reaches into other statics, which are destroyed in no particular order after it
+  static void Shutdown();
+
   // Gets the current game scene
   std::shared_ptr<GameScene> GetScene();
 
-  // Gets the renderer
+  // Gets the renderer. Outside of the render thread, only use it while holding a RendererLock
   SDL_Renderer *GetRenderer() const { return renderer.get(); }
 
+  // Gets the batch through which quads are submitted to the renderer
+  SpriteBatch &GetSpriteBatch() { return spriteBatch; }
+
+  // Gets the layer through which renderer state is changed. Same locking rules as the renderer apply
+  RenderContext &GetRenderContext() { return renderContext; }
+
+  // Gets the thread which executes & presents recorded frames
+  RenderThread &GetRenderThread() { return *renderThread; }
+
+  // Gets the pool which decodes assets in the background
+  AssetLoader &GetAssetLoader() { return *assetLoader; }
+
+  // Gets the manager which plays sample voices on the mixer's channels
+  VoiceManager &GetVoiceManager() { return *voiceManager; }
+
   // Starts the game
   void Start();
 
   float GetDeltaTime() const { return deltaTime; }
   float GetPhysicsDeltaTime() const { return physicsDeltaTime; }
 
+  // Durations of the latest frames, to tell how evenly they are paced
+  const FrameTimings &GetFrameTimings() const { return frameTimings; }
+
   // Requests setting a new scene
   void SetScene(std::shared_ptr<GameScene> scene);
 
@@ -76,13 +111,32 @@ private:
   Game(std::string title, int width, int height);
 
   // Calculates the delta time
-  void CalculateDeltaTime(int &start, float &deltaTime);
+  void CalculateDeltaTime(Uint64 &start, float &deltaTime);
 
   // Actually pushes the next scene to stack
   void TransitionScenes();
 
+  // Loads every asset of the manifest, decoding in the background while showing the progress
+  void Preload(const AssetManifest &manifest);
+
+  // Presents a frame with a loading bar, given how much (from 0 to 1) was loaded
+  void DisplayLoadingProgress(float progress);
+
   void GameLoop();
 
+  // Loop used in headless mode, which advances a simulated clock instead of waiting for real time
+  void HeadlessLoop();
+
+  // Gets the current time, in clock ticks (simulated in headless mode)
+  Uint64 GetTime() const;
+
+  // Ticks between each frame. With vsync pacing, it's a whole number of display refreshes
+  Uint64 GetFrameInterval() const;
+
+  // Hashes and dumps the offscreen surface, as configured by the headless options
+  // Returns the frame's hash
+  uint64_t CaptureFrame();
+
   // Behavior of a frame
   void Frame();
 
@@ -91,7 +145,7 @@ private:
 
 #ifdef DISPLAY_REAL_FPS
   // Counts elapsed frames this second
-  void CountElapsedFrames(int elapsedMilliseconds);
+  void CountElapsedFrames(Uint64 elapsedTicks);
 
   // Displays actual fps on top left corner of screen
   void DisplayRealFps();
@@ -103,14 +157,17 @@ private:
   // ID counter for world objects and components
   int nextId{1};
 
-  // Start time of current frame, in milliseconds
-  int frameStart{(int)SDL_GetTicks()};
+  // Start time of current frame, in clock ticks
+  Uint64 frameStart{Clock::Now()};
 
   // Time elapsed since last frame
   float deltaTime;
 
-  // Start time of current physics frame, in milliseconds
-  int physicsFrameStart{(int)SDL_GetTicks()};
+  // Current simulated time, in milliseconds, used in headless mode
+  int simulatedTicks{0};
+
+  // Start time of current physics frame, in clock ticks
+  Uint64 physicsFrameStart{Clock::Now()};
 
   // Time elapsed since last physics frame
   float physicsDeltaTime;
@@ -124,11 +181,26 @@ private:
 
   // How many physics frames have actually rendered last second
   int physicsFramesInLastSecond{0};
+
+  // Frame rates & pacing of the last second, as displayed
+  std::string realFpsText;
 #endif
 
+  // Durations of the latest frames
+  FrameTimings frameTimings;
+
   // Input manager instance
   InputManager inputManager;
 
+  // Batches quads into as few draw calls as possible
+  SpriteBatch spriteBatch;
+
+  // Skips redundant renderer state changes
+  RenderContext renderContext;
+
+  // Plays sounds. Outlives the scenes, whose sounds stop as they are destroyed
+  std::unique_ptr<VoiceManager> voiceManager;
+
   // Scene to push next frame
   std::shared_ptr<GameScene> nextScene;
 
@@ -140,6 +212,15 @@ private:
 
   // Renderer for the window
   Helper::auto_unique_ptr<SDL_Renderer> renderer;
+
+  // Surface rendered to in headless mode, in place of the window
+  Helper::auto_unique_ptr<SDL_Surface> offscreenSurface;
+
+  // Executes & presents frames with the renderer
+  std::unique_ptr<RenderThread> renderThread;
+
+  // Decodes assets in the background
+  std::unique_ptr<AssetLoader> assetLoader;
 };
 
 #endif
\ No newline at end of file
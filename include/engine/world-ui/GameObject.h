@@ -13,6 +13,7 @@
 #include "Helper.h"
 #include "Tag.h"
 #include "Timer.h"
+#include "Handle.h"
 
 class GameScene;
 
@@ -126,10 +127,21 @@ public:
   // Object's unique identifier
   const int id;
 
+  // Generation checked handle to this object, which stops resolving once it's destroyed
+  const Handle handle;
+
+  // Gets the object a handle refers to, or nullptr if it no longer exists
+  // T must be the object's actual class or one of it's bases
+  template <class T = GameObject>
+  static T *Resolve(Handle target) { return static_cast<T *>(handleTable.Get(target)); }
+
   // This object's tag
   Tag tag{Tag::None};
 
 private:
+  // Table which issues all object handles
+  static HandleTable<GameObject> handleTable;
+
   // The game object's name (not necessarily unique)
   std::string name;
 
@@ -153,9 +165,15 @@ protected:
   // Gets parent, but may return nullptr if no parent
   virtual std::shared_ptr<GameObject> InternalGetParentNoException() const = 0;
 
+  // Resolves the parent handle and ensures it's valid. Cheaper than InternalGetParent, as no pointer is locked
+  GameObject &InternalResolveParent() const;
+
   // Sets a new parent
   virtual void InternalSetParent(std::shared_ptr<GameObject> newParent, std::shared_ptr<GameObject> ownPointer = nullptr) = 0;
 
+  // Handle to the parent, which child classes keep in sync with their parent pointer
+  Handle parentHandle;
+
   // =================================
   // UTILITY
   // =================================
@@ -163,26 +181,20 @@ public:
   // Returns reference to the scene this object exists in
   std::shared_ptr<GameScene> GetScene() const;
 
-  // Allows for delaying a function execution
+  // Allows for delaying a function execution, in this object's simulation time
   // Returns a token id that can be used to cancel execution
   int DelayFunction(std::function<void()> procedure, float seconds);
 
   // Cancels the execution of a previously delayed function, given the token returned by DelayFunction
   void CancelDelayedFunction(int tokenId);
 
-  // A timer helper. Stored values are increased each frame
-  Timer timer;
+  // A timer helper. Stored values follow this object's simulation time
+  Timer timer{simulationTime};
 
 private:
-  // Trigger delayed functions whose timers are up
-  void TriggerDelayedFunctions();
-
   // Scene reference id
   int gameSceneId;
 
-  // Functions currently waiting to be executed (bool indicates if they are still supposed to be called)
-  std::unordered_map<int, std::pair<std::function<void()>, bool>> delayedFunctions;
-
   // =================================
   // MODIFIERS
   // =================================
@@ -194,10 +206,16 @@ public:
   // What the current time scale is
   float GetTimeScale() const;
 
+  // Seconds this object has been updated for, with it's time scale applied
+  double GetSimulationTime() const;
+
 private:
   // Current value of time scale
   float localTimeScale{1};
 
+  // Elapsed simulation time
+  double simulationTime{0};
+
   // =================================
   // OPERATORS
   // =================================
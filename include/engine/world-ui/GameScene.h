@@ -17,6 +17,9 @@
 #include "PhysicsSystem.h"
 #include "ParticleSystem.h"
 #include "Renderable.h"
+#include "Scheduler.h"
+#include "LayerCache.h"
+#include "AssetManifest.h"
 
 class Component;
 class Collider;
@@ -75,6 +78,9 @@ public:
   // A timer helper
   Timer timer;
 
+  // Executes delayed functions of this scene's objects
+  Scheduler scheduler;
+
   // Unique identifier of this scene
   const int id;
 
@@ -98,7 +104,19 @@ public:
   // Whether the game should exit
   bool QuitRequested() { return quitRequested; }
 
+  // Makes the game exit
+  void RequestQuit() { quitRequested = true; }
+
+  // Assets to load before the scene starts: those it declares, plus (optionally) those it was recorded using on previous runs
+  AssetManifest GetAssetManifest(bool includeRecorded = true);
+
 protected:
+  // Allows for child class scenes to declare assets they use, so they are loaded before the scene starts
+  virtual void DeclareAssets(AssetManifest &) {}
+
+  // Where the assets used by this scene are recorded
+  std::string GetManifestPath() const;
+
   // Indicates that the scene mus tbe removed from queue
   bool popRequested{false};
 
@@ -274,20 +292,59 @@ private:
   // Deletes all objects which have requested for destruction
   void CollectDeadObjects();
 
+  // Handles of objects which requested destruction since the last collection
+  std::vector<Handle> destroyQueue;
+
   // =================================
   // RENDERING
   // =================================
 public:
+  // How many things were drawn and how many were culled for being out of view
+  struct RenderStats
+  {
+    int drawn{0};
+    int culled{0};
+  };
+
   // Registers the given Renderable to be rendered on future Render calls
-  void RegisterLayerRenderer(std::shared_ptr<Renderable> component);
+  void RegisterLayerRenderer(Renderable &renderable);
+
+  // Whether the given world area is out of the main camera's view, and so should not be rendered
+  // Counts it as either drawn or culled. Only valid during Render
+  bool Cull(const Rectangle &bounds);
+  bool Cull(Vector2 center, float width, float height);
+
+  // Stats of the last render (or of the current one, during Render)
+  RenderStats GetRenderStats() const;
 
-  // Sorts the render layer by the members render order
-  void Sort(std::vector<std::weak_ptr<Renderable>> &components);
+  // Keeps the layer composed in a texture, drawing it with a single quad while it doesn't change
+  // Only for layers whose renderables stand still and share the given parallax
+  void CacheLayer(RenderLayer layer, float parallax = 0);
 
   // Gets all available cameras in this scene
   std::list<std::shared_ptr<Camera>> GetCameras();
 
 private:
+  // A Renderable in a render layer, along with the render order it had when last checked
+  struct RenderEntry
+  {
+    Handle renderable;
+    int renderOrder;
+  };
+
+  // Refreshes the cached render orders of the layer, and sorts it only if they are out of order (because an order changed or entries were added)
+  // Entries whose Renderable no longer exists are dropped along the way
+  void Sort(std::vector<RenderEntry> &entries);
+
+  // Removes the entries of destroyed Renderables from every layer
+  void PruneRenderables();
+
+  // Renders the layer's entries which are in view
+  void RenderEntries(const std::vector<RenderEntry> &entries);
+
+  // Draws the layer from it's cache, composing it again first if needed
+  void RenderCachedLayer(const std::vector<RenderEntry> &entries, LayerCache &cache);
+
   // Registers a camera to the scene
   void RegisterCamera(std::shared_ptr<Camera> camera);
 
@@ -295,7 +352,15 @@ private:
   std::list<std::weak_ptr<Camera>> camerasWeak;
 
   // Structure that maps each render layer to the Renderables in it
-  std::unordered_map<RenderLayer, std::vector<std::weak_ptr<Renderable>>> layerStructure;
+  std::unordered_map<RenderLayer, std::vector<RenderEntry>> layerStructure;
+
+  // Caches of the layers which are drawn from a texture
+  std::unordered_map<RenderLayer, LayerCache> layerCaches;
+
+  // Main camera's view during the current render, including culling margin
+  Rectangle cullingView;
+
+  RenderStats renderStats;
 
   // =================================
   // UTILITY
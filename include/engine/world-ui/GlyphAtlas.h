@@ -0,0 +1,53 @@
+#ifndef __GLYPH_ATLAS__
+#define __GLYPH_ATLAS__
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <SDL_ttf.h>
+#include "TextureAtlas.h"
+#include "Vector2.h"
+#include "Color.h"
+
+// Renders each glyph of a font only once, packing it in a texture atlas, so text can be drawn as batched quads with no texture creation
+// Glyphs are rendered in white and tinted through vertex color. Outlined glyphs are rendered with TTF_SetFontOutline and cached per outline size
+class GlyphAtlas
+{
+public:
+  GlyphAtlas(std::shared_ptr<TTF_Font> font, TextureAtlas &atlas);
+
+  // Width of the text, in pixels, when drawn with the given outline
+  int MeasureWidth(const std::string &text, int outline = 0);
+
+  // Height of the text, in pixels, when drawn with the given outline
+  int MeasureHeight(int outline = 0) const;
+
+  // Queues the text with it's top left corner at the given screen position
+  // When outline is positive, the text is surrounded by an outline of that many pixels in the outline color
+  void Draw(const std::string &text, Vector2 position, Color color, int outline = 0, Color outlineColor = Color::Black());
+
+private:
+  struct Glyph
+  {
+    TextureAtlas::Region region;
+
+    // How far to move the pen after this glyph
+    int advance;
+  };
+
+  // Gets the glyph, rendering it if it's not cached yet
+  const Glyph &GetGlyph(unsigned char character, int outline);
+
+  // Queues a line of glyphs
+  void DrawGlyphs(const std::string &text, Vector2 position, Color color, int outline);
+
+  std::shared_ptr<TTF_Font> font;
+
+  // Where glyphs are packed
+  TextureAtlas &atlas;
+
+  // Cached glyphs, by outline and character
+  std::unordered_map<int, Glyph> glyphs;
+};
+
+#endif
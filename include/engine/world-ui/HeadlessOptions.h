@@ -0,0 +1,28 @@
+#ifndef __HEADLESS_OPTIONS__
+#define __HEADLESS_OPTIONS__
+
+#include <string>
+
+// Configures running the game without a window, with the software renderer drawing onto an offscreen surface
+// Time is simulated in fixed steps and randomness is seeded with a constant, so that the same build always renders the same frames
+struct HeadlessOptions
+{
+  // Whether to run headless at all
+  bool enabled{false};
+
+  // How many frames to render before quitting (0 to run until the scene requests to quit)
+  unsigned long frameLimit{300};
+
+  // Whether to print a hash of each frame's pixels
+  bool hashFrames{false};
+
+  // Directory in which to dump each frame as a bitmap (empty for no dumps)
+  std::string dumpDirectory;
+
+  // Reads options from the command line
+  // Accepts --headless, --frames <count>, --hash-frames and --dump-frames <directory>
+  // Headless mode can also be enabled by setting the BOTECO_HEADLESS environment variable to anything other than 0
+  static HeadlessOptions Parse(int argc, char **argv);
+};
+
+#endif
@@ -36,9 +36,7 @@ public:
   EventI<Vector2> OnClickDown, OnClickUp;
 
   // Poll SDL events
-  // Returns how many seconds the SDL_PollEvent function took to execute, in total
-  // Reason: SDL_PollEvent may suspend the execution if user drags or resizes screen
-  float Update();
+  void Update();
 
   bool KeyPress(int key) { return keyState[key] == true && keyUpdate[key] == updateCounter; }
   bool KeyRelease(int key) { return keyState[key] == false && keyUpdate[key] == updateCounter; }
@@ -0,0 +1,63 @@
+#ifndef __LAYER_CACHE__
+#define __LAYER_CACHE__
+
+#include <memory>
+#include <SDL.h>
+#include "Vector2.h"
+
+class Camera;
+
+// Keeps a render layer composed in a target texture, so that while it doesn't change it's drawn with a single quad
+// The texture covers the screen plus a margin on each side. Camera movement is followed by displacing the quad, and the layer is only composed again when
+// the margin runs out, when the camera's size drifts past the tolerance, or when the layer's content changes
+// A parallaxed layer is composed again on any change of the camera's size, as it's renderables don't scale along with the camera
+// Everything in the layer must stand still and share the same parallax
+class LayerCache
+{
+public:
+  // How many pixels beyond each side of the screen are composed
+  static const int margin;
+
+  // Parallax shared by the layer's renderables. Size tolerance is relative to the camera's size when composed, and only applies without parallax
+  LayerCache(float parallax = 0, float sizeTolerance = 0.05f);
+
+  // Whether the layer must be composed again, given the current camera and a signature of the layer's content
+  bool NeedsCompose(const Camera &camera, size_t signature) const;
+
+  // Redirects rendering into the texture. The layer must then be rendered as usual, followed by EndCompose
+  void BeginCompose(const Camera &camera, size_t signature);
+
+  // Sends rendering back to the window
+  void EndCompose();
+
+  // Queues the composed layer as a single quad
+  void Draw(const Camera &camera) const;
+
+private:
+  // Where the texture should be drawn on the screen for the given camera
+  SDL_FRect GetScreenRect(const Camera &camera) const;
+
+  // Creates the target texture
+  void CreateTexture();
+
+  float parallax;
+
+  float sizeTolerance;
+
+  std::shared_ptr<SDL_Texture> texture;
+
+  // Dimensions of the texture
+  int width, height;
+
+  // === CAMERA WHEN COMPOSED
+
+  Vector2 composedTopLeft;
+  Vector2 composedPosition;
+  float composedSize{0};
+  float composedPixelsPerUnit{1};
+
+  // Signature of the layer's content when composed
+  size_t composedSignature{0};
+};
+
+#endif
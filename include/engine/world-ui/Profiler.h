@@ -0,0 +1,89 @@
+#ifndef __PROFILER__
+#define __PROFILER__
+
+#include <string>
+#include <vector>
+#include <SDL.h>
+#include "Clock.h"
+#include "BuildConfigurations.h"
+
+// Profiles the enclosing scope under the given name (a string literal). Compiles to nothing unless PROFILE_FRAMES is defined
+#ifdef PROFILE_FRAMES
+#define PROFILE_ZONE_JOIN(first, second) first##second
+#define PROFILE_ZONE_NAME(line) PROFILE_ZONE_JOIN(profilerZone, line)
+#define PROFILE_ZONE(name) ProfilerZone PROFILE_ZONE_NAME(__LINE__)(name)
+#else
+#define PROFILE_ZONE(name)
+#endif
+
+// Keeps the latest zones timed on each thread, in a ring per thread, and exports them as a Chrome trace (viewable in chrome://tracing or Perfetto)
+// Zones nest by time, so a zone opened inside another shows up as it's child
+class Profiler
+{
+public:
+  // How many zones each thread keeps
+  static const size_t zonesPerThread;
+
+  // Records a zone on the calling thread. Name must outlive the profiler
+  static void Record(const char *name, Uint64 start, Uint64 end);
+
+  // Names the calling thread in exported traces
+  static void SetThreadName(std::string name);
+
+  // Writes every kept zone of every thread as trace event JSON. Returns whether it was written
+  static bool ExportTrace(std::string path);
+
+private:
+  // A timed scope
+  struct Zone
+  {
+    const char *name;
+    Uint64 start;
+    Uint64 end;
+  };
+
+  // Zones of a single thread
+  struct ThreadRing
+  {
+    std::string name;
+
+    // Id in exported traces
+    int id;
+
+    std::vector<Zone> zones;
+
+    // Where the next zone goes
+    size_t next{0};
+
+    // How many zones the ring holds
+    size_t count{0};
+
+    // Guards the ring from being exported while it's written. Only contended during exports
+    SDL_mutex *mutex;
+  };
+
+  // Ring of the calling thread, created on it's first use
+  static ThreadRing &GetThreadRing();
+
+  // Every thread's ring. Rings are never destroyed, as their threads may record until the program exits
+  static std::vector<ThreadRing *> rings;
+};
+
+// Records the time from it's construction to it's destruction as a zone
+class ProfilerZone
+{
+public:
+  ProfilerZone(const char *name) : name(name), start(Clock::Now()) {}
+
+  ~ProfilerZone() { Profiler::Record(name, start, Clock::Now()); }
+
+  ProfilerZone(const ProfilerZone &) = delete;
+  ProfilerZone &operator=(const ProfilerZone &) = delete;
+
+private:
+  const char *name;
+
+  Uint64 start;
+};
+
+#endif
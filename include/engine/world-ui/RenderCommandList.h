@@ -0,0 +1,79 @@
+#ifndef __RENDER_COMMAND_LIST__
+#define __RENDER_COMMAND_LIST__
+
+#include <memory>
+#include <vector>
+#include <SDL.h>
+#include "Color.h"
+#include "RenderContext.h"
+
+// Everything a frame draws, recorded in order so that it can be executed later, away from the simulation
+// Textures used by recorded commands are kept alive until the list is reset
+class RenderCommandList
+{
+public:
+  // Sets the texture to render to (nullptr for the window)
+  void Target(const std::shared_ptr<SDL_Texture> &texture);
+
+  // Fills the whole target with a color
+  void Clear(Color color);
+
+  // Draws triangles with the texture (nullptr for solid color). Indices are relative to the given vertices
+  void Geometry(const std::shared_ptr<SDL_Texture> &texture, const std::vector<SDL_Vertex> &vertices, const std::vector<int> &indices);
+
+  // Draws each point
+  void Points(Color color, const std::vector<SDL_FPoint> &points);
+
+  // Draws lines connecting each point to the next, split into strips of the given lengths
+  void LineStrips(Color color, const std::vector<SDL_FPoint> &points, const std::vector<int> &stripLengths);
+
+  // Issues each command to the renderer, in the order they were recorded
+  void Execute(SDL_Renderer *renderer, RenderContext &context) const;
+
+  // Discards all commands, releasing their textures
+  void Reset();
+
+  // How many commands were recorded
+  int Count() const { return int(commands.size()); }
+
+private:
+  enum class CommandType
+  {
+    Target,
+    Clear,
+    Geometry,
+    Points,
+    LineStrips
+  };
+
+  struct Command
+  {
+    CommandType type;
+
+    Color color;
+
+    // Index of the command's texture in textures (-1 for none)
+    int texture{-1};
+
+    // Range of the command's vertices or points
+    int first{0}, count{0};
+
+    // Range of the command's indices or strip lengths
+    int firstIndex{0}, indexCount{0};
+  };
+
+  // Keeps the texture alive until executed, returning it's index in textures (-1 for nullptr)
+  int KeepTexture(const std::shared_ptr<SDL_Texture> &texture);
+
+  std::vector<Command> commands;
+
+  // === COMMAND DATA
+
+  std::vector<SDL_Vertex> vertices;
+  std::vector<int> indices;
+  std::vector<SDL_FPoint> points;
+  std::vector<int> stripLengths;
+  std::vector<std::shared_ptr<SDL_Texture>> textures;
+};
+
+#endif
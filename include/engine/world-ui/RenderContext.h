@@ -0,0 +1,84 @@
+#ifndef __RENDER_CONTEXT__
+#define __RENDER_CONTEXT__
+
+#include <memory>
+#include <unordered_map>
+#include <SDL.h>
+#include "Color.h"
+
+// Sits between engine code and the SDL renderer, remembering the state it was left in so that calls which wouldn't change anything are skipped
+// All draw color, blend mode, render target and texture modulation changes must go through it, or it's knowledge of the state becomes stale
+class RenderContext
+{
+public:
+  // How many state changes were requested and how many actually reached the renderer
+  struct Stats
+  {
+    int requested{0};
+    int applied{0};
+  };
+
+  void SetDrawColor(Color color);
+
+  void SetDrawBlendMode(SDL_BlendMode blendMode);
+
+  // Sets the texture to render to (nullptr for the window)
+  void SetTarget(SDL_Texture *target);
+
+  // Sets the texture's color and alpha modulation
+  void SetTextureColorMod(const std::shared_ptr<SDL_Texture> &texture, Color color);
+
+  void SetTextureBlendMode(const std::shared_ptr<SDL_Texture> &texture, SDL_BlendMode blendMode);
+
+  // Resets the stats, returning those of the frame that just ended
+  Stats EndFrame();
+
+  // Stats of the current frame so far
+  Stats GetStats() const;
+
+private:
+  // A value the renderer is known to have, if any
+  template <typename T>
+  struct Known
+  {
+    T value{};
+    bool known{false};
+
+    // Stores the new value, returning whether it differs from the known one
+    bool Update(const T &newValue)
+    {
+      if (known && value == newValue)
+        return false;
+
+      value = newValue;
+      known = true;
+      return true;
+    }
+  };
+
+  // What is known of a texture's state
+  struct TextureState
+  {
+    // Lets us know when the texture is destroyed, as it's address may be reused by a new one
+    std::weak_ptr<SDL_Texture> weakTexture;
+
+    Known<Color> colorMod;
+    Known<SDL_BlendMode> blendMode;
+  };
+
+  // Gets the known state of this texture, discarding it if it belonged to a destroyed texture
+  TextureState &GetState(const std::shared_ptr<SDL_Texture> &texture);
+
+  // Counts a requested change, returning whether it must be applied
+  bool Count(bool changed);
+
+  Known<Color> drawColor;
+  Known<SDL_BlendMode> drawBlendMode;
+  Known<SDL_Texture *> target;
+
+  std::unordered_map<SDL_Texture *, TextureState> textureStates;
+
+  Stats stats;
+};
+
+#endif
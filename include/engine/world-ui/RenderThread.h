@@ -0,0 +1,82 @@
+#ifndef __RENDER_THREAD__
+#define __RENDER_THREAD__
+
+#include <SDL.h>
+#include "RenderCommandList.h"
+#include "RenderContext.h"
+
+// Holds the renderer lock for as long as it lives
+// Any use of the renderer outside of command lists (such as creating, updating or destroying textures) must hold it, as the render thread may be using the renderer at the same time
+// The lock is reentrant
+class RendererLock
+{
+public:
+  RendererLock();
+  ~RendererLock();
+
+  RendererLock(const RendererLock &) = delete;
+  RendererLock &operator=(const RendererLock &) = delete;
+};
+
+// Executes and presents recorded frames on it's own thread, so that presenting a frame (and waiting for vsync or the driver) overlaps with simulating the next one
+// Two command lists are used: while the simulation records one, the other is executed
+class RenderThread
+{
+public:
+  // When not threaded, frames are executed and presented right as they are submitted
+  RenderThread(SDL_Renderer *renderer, RenderContext &context, bool threaded);
+
+  ~RenderThread();
+
+  // List the current frame is recorded into
+  RenderCommandList &GetRecordingList() { return *recording; }
+
+  // Hands the recorded frame over to be executed and presented
+  // First waits for the previous frame to be presented, so the simulation is never more than a frame ahead
+  void Submit();
+
+  // Waits until every submitted frame has been presented
+  void Finish();
+
+  // Renderer state change stats of the last presented frame
+  RenderContext::Stats GetLastContextStats();
+
+  // Destroys a texture while holding the renderer lock. Use it as the deleter of texture pointers
+  static void DestroyTexture(SDL_Texture *texture);
+
+private:
+  // Loop of the render thread
+  static int Run(void *renderThread);
+
+  // Executes & presents the list, then resets it
+  void Present(RenderCommandList &list);
+
+  SDL_Renderer *renderer;
+
+  RenderContext &context;
+
+  // Double buffered command lists
+  RenderCommandList lists[2];
+
+  // List being recorded by the simulation
+  RenderCommandList *recording{&lists[0]};
+
+  // List submitted to the render thread which wasn't presented yet (nullptr if none)
+  RenderCommandList *submitted{nullptr};
+
+  RenderContext::Stats lastContextStats;
+
+  // === THREADING
+
+  SDL_Thread *thread{nullptr};
+
+  // Guards the fields shared with the render thread
+  SDL_mutex *mutex{nullptr};
+
+  // Signals changes to the submitted list or to stopRequested
+  SDL_cond *condition{nullptr};
+
+  bool stopRequested{false};
+};
+
+#endif
@@ -2,6 +2,8 @@
 #define __RENDERABLE__
 
 #include "RenderLayer.h"
+#include "Handle.h"
+#include "Rectangle.h"
 
 class GameScene;
 
@@ -11,6 +13,17 @@ class Renderable
   friend class GameScene;
 
 public:
+  Renderable();
+  Renderable(const Renderable &) = delete;
+
+  virtual ~Renderable();
+
+  // Gets the renderable a handle refers to, or nullptr if it no longer exists
+  static Renderable *Resolve(Handle target) { return handleTable.Get(target); }
+
+  // Generation checked handle to this renderable, which is what the scene's render layers hold
+  const Handle renderHandle;
+
   // In which render layer this component is
   // If None, then it's Render method will never be called
   virtual RenderLayer GetRenderLayer() { return RenderLayer::None; }
@@ -18,16 +31,31 @@ public:
   // The order in which to render this component in it's layer (higher numbers are shown on top)
   virtual int GetRenderOrder() { return 0; }
 
+  // Gets the area this renderable covers in the world, in units, so it can be culled when out of view
+  // Returns false if it has no world bounds, in which case it is never culled
+  virtual bool GetWorldBounds(Rectangle &) { return false; }
+
+  // Changes whenever how this renderable looks changes (position aside), so that cached drawings of it know to refresh
+  unsigned GetContentVersion() const { return contentVersion; }
+
 protected:
   // Registers this component's render layer if it is not None
   virtual void RegisterLayer() = 0;
 
+  // Signals that how this renderable looks has changed
+  void ChangedContent() { contentVersion++; }
+
 private:
   // Whether this data type should be rendered at the moment of this call
   virtual bool ShouldRender() { return true; }
 
   // Called once per frame to render to the screen
   virtual void Render() {}
+
+  // Table which issues all renderable handles
+  static HandleTable<Renderable> handleTable;
+
+  unsigned contentVersion{0};
 };
 
 #endif
\ No newline at end of file
@@ -4,6 +4,11 @@
 #include <functional>
 #include <unordered_map>
 #include <memory>
+#include <deque>
+#include <vector>
+#include <set>
+#include <climits>
+#include <cstdint>
 #include <SDL.h>
 #include <SDL_mixer.h>
 #include <SDL_image.h>
@@ -11,16 +16,86 @@
 #include "Helper.h"
 #include "Sprite.h"
 #include "Rectangle.h"
+#include "TextureAtlas.h"
+#include "GlyphAtlas.h"
+#include "AssetLoader.h"
+#include "AssetManifest.h"
+#include "Profiler.h"
 
+// Caches every loaded asset. Assets nothing else holds stay cached until the memory budget is exceeded, and are then evicted least recently used first
 class Resources
 {
 public:
+  // Identifies an interned resource key. Getting a resource through it is a plain array index, with no hashing
+  // Handles stay valid for the whole program
+  template <class T>
+  struct AssetHandle
+  {
+    uint32_t index{UINT32_MAX};
+
+    bool IsValid() const { return index != UINT32_MAX; }
+  };
+
+  using ImageHandle = AssetHandle<TextureAtlas::Region>;
+  using SoundHandle = AssetHandle<Mix_Chunk>;
+  using MusicHandle = AssetHandle<Mix_Music>;
+
+  // A cached resource
+  template <class T>
+  struct CacheEntry
+  {
+    // Interned key
+    std::string key;
+
+    // Null while not loaded (or after being evicted)
+    std::shared_ptr<T> resource;
+
+    // Memory it takes
+    size_t bytes;
+
+    // When it was last got, from useCounter
+    unsigned long lastUse;
+
+    // Whether it was recorded since the last reset
+    bool recorded;
+  };
+
+  // Cache statistics of a resource type
+  struct CacheStats
+  {
+    unsigned long hits{0};
+    unsigned long misses{0};
+    unsigned long evictions{0};
+
+    // Memory taken by the cached resources
+    size_t residentBytes{0};
+  };
+
   // Type of resource table
   template <class T>
-  using table = std::unordered_map<std::string, std::shared_ptr<T>>;
+  struct table
+  {
+    table(const char *name) : name(name) {}
+
+    // Name of the resource type, for stats
+    const char *name;
+
+    // Index of each interned key's entry
+    std::unordered_map<std::string, uint32_t> indices;
+
+    // Entries by handle index. They are never removed, so handles stay valid
+    std::vector<CacheEntry<T>> entries;
 
-  // Get an image texture
-  static std::shared_ptr<SDL_Texture> GetTexture(std::string filename);
+    CacheStats stats;
+  };
+
+  // How much memory cached resources may take before unused ones are evicted
+  // Only decoded pixels & sound samples are counted: fonts, music streams & sprites are negligible or not measurable
+  static size_t memoryBudget;
+
+  // Get an image, packed into the texture atlas
+  static std::shared_ptr<TextureAtlas::Region> GetImage(std::string filename);
+  static std::shared_ptr<TextureAtlas::Region> GetImage(ImageHandle image);
 
   // Get a cropped sprite
   static std::shared_ptr<Sprite> GetSprite(std::string filename, SDL_Rect clipRect = SDL_Rect{0, 0, -1, -1});
@@ -29,43 +104,98 @@ public:
 
   // Get a music
   static std::shared_ptr<Mix_Music> GetMusic(std::string filename);
+  static std::shared_ptr<Mix_Music> GetMusic(MusicHandle music);
 
   // Get an sfx
   static std::shared_ptr<Mix_Chunk> GetSound(std::string filename);
+  static std::shared_ptr<Mix_Chunk> GetSound(SoundHandle sound);
+
+  // Intern a filename, giving a handle through which it can be got without hashing it again
+  // Doesn't load anything
+  static ImageHandle InternImage(std::string filename) { return {Intern(imageTable, filename)}; }
+  static SoundHandle InternSound(std::string filename) { return {Intern(soundTable, filename)}; }
+  static MusicHandle InternMusic(std::string filename) { return {Intern(musicTable, filename)}; }
 
   // Get a font
   static std::shared_ptr<TTF_Font> GetFont(std::string filename, int size);
 
-  // Clear everything
-  static void ClearAll()
+  // Get the glyph atlas of a font, whose glyphs are packed in the same atlas as images
+  static std::shared_ptr<GlyphAtlas> GetGlyphAtlas(std::string filename, int size);
+
+  // === BACKGROUND LOADING
+
+  // Start decoding an asset in the background, so that getting it later doesn't hitch
+  // Getting an asset whose request isn't ready yet waits for it
+  static std::shared_ptr<AssetRequest> LoadImageAsync(std::string filename);
+  static std::shared_ptr<AssetRequest> LoadSoundAsync(std::string filename);
+  static std::shared_ptr<AssetRequest> LoadMusicAsync(std::string filename);
+
+  // Stores assets which finished decoding. Must be called once per frame, from the main thread
+  // Images are packed into the atlas only until the upload budget runs out, the rest is left for the next frames
+  static void CompleteLoads();
+
+  // Drops background loads which weren't stored yet
+  // Their decoded data is only freed once the asset loader has been cancelled as well
+  static void CancelLoads()
   {
-    ClearTable(musicTable);
-    ClearTable(textureTable);
-    ClearTable(soundTable);
-    ClearTable(spriteTable);
-    ClearTable(fontTable);
+    pendingRequests.clear();
+    uploadQueue.clear();
   }
 
+  // How many bytes of pixels may be uploaded each frame by CompleteLoads
+  static const size_t uploadBudget;
+
+  // === MANIFEST RECORDING
+
+  // Every asset got since the last reset
+  static const AssetManifest &GetRecordedAssets() { return recordedAssets; }
+
+  static void ResetRecordedAssets();
+
+  // === CACHE
+
+  // Evicts resources nothing else holds, least recently used first, until the cache fits the budget
+  static void Trim(size_t budget = memoryBudget);
+
+  // Evicts every resource nothing else holds
+  static void ClearAll() { Trim(0); }
+
+  // Memory taken by every cached resource, counting whole atlas pages rather than the images on them
+  static size_t GetResidentBytes();
+
+  // Stats of each resource type, along with it's name
+  static std::vector<std::pair<std::string, CacheStats>> GetStats();
+
 private:
   // Get a resource
   // resourceKeyRaw is useful when the key is a construct of a filename and something else. It will be provided to the loader
   template <class Resource>
   static std::shared_ptr<Resource> GetResource(
       std::string resourceType,
-      std::string resourceKey,
+      uint32_t index,
       table<Resource> &table,
       std::function<Resource *(std::string)> resourceLoader,
       void (*resourceDestructor)(Resource *),
       std::string resourceKeyRaw = "")
   {
+    Helper::Assert(index < table.entries.size(), "Invalid " + resourceType + " handle");
+
     // Check if it's already loaded
-    auto resourceIterator = table.find(resourceKey);
+    auto &entry = table.entries[index];
 
     // If so, return the loaded asset
-    if (resourceIterator != table.end())
-      return resourceIterator->second;
+    if (entry.resource != nullptr)
+    {
+      table.stats.hits++;
+      entry.lastUse = useCounter++;
+
+      return entry.resource;
+    }
 
     // At this point, we know the asset isn't loaded yet
+    PROFILE_ZONE("Resources::Load");
+
+    std::string resourceKey = entry.key;
 
     // Get which key will be sent to loader
     std::string key = resourceKeyRaw == "" ? resourceKey : resourceKeyRaw;
@@ -77,37 +207,144 @@ private:
     Helper::Assert(resourcePointer != nullptr, "Failed to load " + resourceType + " at " + resourceKey);
 
     // Store the texture (create the pointer with the destructor)
-    table.emplace(
-        std::piecewise_construct,
-        std::forward_as_tuple(resourceKey),
-        std::forward_as_tuple(resourcePointer, resourceDestructor));
+    return Insert(table, index, std::shared_ptr<Resource>(resourcePointer, resourceDestructor));
+  }
+
+  // Get a resource by it's key, interning it
+  template <class Resource>
+  static std::shared_ptr<Resource> GetResource(
+      std::string resourceType,
+      std::string resourceKey,
+      table<Resource> &table,
+      std::function<Resource *(std::string)> resourceLoader,
+      void (*resourceDestructor)(Resource *),
+      std::string resourceKeyRaw = "")
+  {
+    return GetResource(resourceType, Intern(table, resourceKey), table, resourceLoader, resourceDestructor, resourceKeyRaw);
+  }
+
+  // Gives the index of the key's entry, creating an empty one if it's new
+  template <class Resource>
+  static uint32_t Intern(table<Resource> &table, const std::string &key)
+  {
+    auto [indexIterator, isNew] = table.indices.emplace(key, uint32_t(table.entries.size()));
+
+    if (isNew)
+      table.entries.push_back(CacheEntry<Resource>{key, nullptr, 0, 0, false});
+
+    return indexIterator->second;
+  }
+
+  // Records the entry in the given set, if it wasn't since the last reset, and gives it's resource if it's loaded (counting a hit)
+  // Getting a loaded resource through it's handle does nothing more
+  template <class Resource>
+  static std::shared_ptr<Resource> GetLoaded(table<Resource> &table, uint32_t index, std::set<std::string> &recorded)
+  {
+    Helper::Assert(index < table.entries.size(), std::string("Invalid ") + table.name + " handle");
+
+    auto &entry = table.entries[index];
+
+    if (entry.recorded == false)
+    {
+      recorded.insert(entry.key);
+      entry.recorded = true;
+    }
+
+    if (entry.resource == nullptr)
+      return nullptr;
+
+    table.stats.hits++;
+    entry.lastUse = useCounter++;
+
+    return entry.resource;
+  }
+
+  // Caches a loaded resource in the entry, counting it as a miss
+  template <class Resource>
+  static std::shared_ptr<Resource> Insert(table<Resource> &table, uint32_t index, std::shared_ptr<Resource> resource)
+  {
+    auto &entry = table.entries[index];
+    auto bytes = SizeOf(*resource);
+
+    table.stats.misses++;
+    table.stats.residentBytes += bytes;
+
+    entry.resource = resource;
+    entry.bytes = bytes;
+    entry.lastUse = useCounter++;
 
-    // Now that it's loaded, return it
-    return table[resourceKey];
+    // Make room for it
+    if (GetResidentBytes() > memoryBudget)
+      Trim();
+
+    return resource;
   }
 
+  // Memory taken by each type of resource
+  // Images on atlas pages take none of their own: the pages are counted instead
+  static size_t SizeOf(const TextureAtlas::Region &image) { return image.paged ? 0 : size_t(image.rect.w) * image.rect.h * 4; }
+  static size_t SizeOf(const Mix_Chunk &chunk) { return chunk.alen; }
+  static size_t SizeOf(const Sprite &) { return sizeof(Sprite); }
+  static size_t SizeOf(const Mix_Music &) { return 0; }
+  static size_t SizeOf(const TTF_Font &) { return 0; }
+  static size_t SizeOf(const GlyphAtlas &) { return sizeof(GlyphAtlas); }
+
+  // When the least recently used resource of the table which nothing else holds was last used (ULONG_MAX if there is none)
   template <class Resource>
-  static void ClearTable(table<Resource> &table)
+  static unsigned long GetOldestUnused(const table<Resource> &table)
   {
-    // Iterate through it
-    auto entryIterator = table.begin();
-    while (entryIterator != table.end())
+    unsigned long oldest{ULONG_MAX};
+
+    for (auto &entry : table.entries)
+      if (entry.resource.use_count() == 1 && entry.lastUse < oldest)
+        oldest = entry.lastUse;
+
+    return oldest;
+  }
+
+  // Evicts the resource last used at the given time, if it's in the table. Returns whether it was
+  template <class Resource>
+  static bool Evict(table<Resource> &table, unsigned long lastUse)
+  {
+    for (auto &entry : table.entries)
     {
-      // Check if the table's is the only reference left
-      if (entryIterator->second.unique())
-      {
-        // If so, delete it
-        entryIterator = table.erase(entryIterator);
-      }
-
-      // Otherwise, keep it around
-      else
-        entryIterator++;
+      if (entry.resource == nullptr || entry.lastUse != lastUse)
+        continue;
+
+      table.stats.evictions++;
+      table.stats.residentBytes -= entry.bytes;
+
+      // Keep the entry, so it's handles stay valid
+      entry.resource = nullptr;
+      entry.bytes = 0;
+
+      return true;
     }
+
+    return false;
   }
 
-  // Store textures
-  static table<SDL_Texture> textureTable;
+  // Starts a background load, unless the asset is already loaded or being loaded
+  template <class Resource>
+  static std::shared_ptr<AssetRequest> LoadAsync(AssetRequest::Type type, std::string filename, table<Resource> &table);
+
+  // If the asset is being loaded in the background, waits for it and stores it
+  static void AwaitPending(AssetRequest::Type type, std::string filename);
+
+  // Moves the request's decoded data into it's table
+  static void Store(const std::shared_ptr<AssetRequest> &request);
+
+  // Key of a request in pendingRequests
+  static std::string GetRequestKey(AssetRequest::Type type, std::string filename)
+  {
+    return std::to_string(int(type)) + "$" + filename;
+  }
+
+  // Store images
+  static table<TextureAtlas::Region> imageTable;
+
+  // Where images are packed into
+  static TextureAtlas atlas;
 
   // Store sprites
   static table<Sprite> spriteTable;
@@ -120,6 +357,21 @@ private:
 
   // Store fonts
   static table<TTF_Font> fontTable;
+
+  // Store glyph atlases
+  static table<GlyphAtlas> glyphAtlasTable;
+
+  // Background loads which weren't stored yet
+  static std::unordered_map<std::string, std::shared_ptr<AssetRequest>> pendingRequests;
+
+  // Decoded requests waiting for upload budget
+  static std::deque<std::shared_ptr<AssetRequest>> uploadQueue;
+
+  // Assets got since the last reset
+  static AssetManifest recordedAssets;
+
+  // Increases with each use of a resource, ordering them by recency
+  static unsigned long useCounter;
 };
 
 #endif
\ No newline at end of file
@@ -0,0 +1,84 @@
+#ifndef __SCHEDULER__
+#define __SCHEDULER__
+
+#include <functional>
+#include <vector>
+#include <unordered_map>
+#include "Handle.h"
+
+// Executes functions after a delay, measured in the simulation time of the object that owns them (so it respects the object's time scale)
+// Pending entries sit in a min heap ordered by the scene time at which they are expected to be due, so only the earliest ones are ever looked at
+// Scheduling is O(log n) and idle entries cost nothing per frame. Canceling is O(1): canceled entries are dropped when they reach the top of the heap
+class Scheduler
+{
+public:
+  // Schedules the procedure to execute once the given seconds have elapsed for the owner object
+  // Without an owner, scene time is used instead
+  // The procedure is discarded if the owner is destroyed before it is due
+  // Returns a token that can be used to cancel execution
+  int Schedule(std::function<void()> procedure, float seconds, Handle owner = Handle());
+
+  // Cancels a pending procedure. Does nothing if it was already executed or canceled
+  void Cancel(int token);
+
+  // Whether the token refers to a procedure that is still waiting to be executed
+  bool IsPending(int token) const;
+
+  // Advances scene time and executes due procedures
+  void Update(float deltaTime);
+
+  // Estimates again when each entry will be due
+  // Must be called whenever an object's time scale changes
+  void Retime();
+
+  // Seconds elapsed in the scene
+  double GetTime() const;
+
+  // How many procedures are waiting to be executed
+  size_t Count() const;
+
+private:
+  struct Entry
+  {
+    // Scene time at which the entry is expected to be due
+    double dueTime;
+
+    // Owner's simulation time at which the entry is actually due
+    double ownerDueTime;
+
+    // Object whose time is followed (null for scene time)
+    Handle owner;
+
+    int token;
+  };
+
+  // Heap comparison which keeps the earliest entry at the front, breaking ties by scheduling order
+  static bool IsLater(const Entry &first, const Entry &second);
+
+  // Updates the entry's due time from it's owner's current clock and time scale
+  // Returns false if the owner no longer exists
+  bool Estimate(Entry &entry) const;
+
+  // Inserts an entry in the heap
+  void Push(const Entry &entry);
+
+  // Entries waiting to be due
+  std::vector<Entry> heap;
+
+  // Procedures of entries still pending, by token
+  std::unordered_map<int, std::function<void()>> procedures;
+
+  // Entries scheduled while due ones are executing. They only join the heap once the update is done
+  std::vector<Entry> deferredEntries;
+
+  // Whether due procedures are currently being executed
+  bool updating{false};
+
+  // Current scene time
+  double time{0};
+
+  // Token to give to the next entry
+  int nextToken{1};
+};
+
+#endif
@@ -0,0 +1,68 @@
+#ifndef __SOUND_BANK__
+#define __SOUND_BANK__
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include <SDL_mixer.h>
+#include "Resources.h"
+
+// Which voice limit a sample counts towards
+enum class SoundCategory
+{
+  // Hits, swings, steps
+  Effect,
+  // Grunts & death cries
+  Voice,
+  // Menus & announcements, which play at the listener
+  Interface,
+  // Loops, which play at the listener
+  Ambience
+};
+
+// Every sample which may be played, identified by an integer
+// Samples are decoded to the mixer's PCM format in the background as soon as they are registered, and held until released, so playing them never decodes
+class SoundBank
+{
+public:
+  // A registered sample
+  struct Sample
+  {
+    std::string path;
+
+    Resources::SoundHandle handle;
+
+    SoundCategory category;
+
+    // Higher priority voices may steal lower (or equal) priority ones
+    int priority;
+
+    // Held once decoded
+    std::shared_ptr<Mix_Chunk> chunk;
+  };
+
+  // Registers the sample at the path and starts decoding it. Registering a path again gives it's existing id
+  // The category & priority of it's first registration are kept
+  static int Register(std::string path, SoundCategory category = SoundCategory::Effect, int priority = 0);
+
+  static const Sample &GetSample(int id);
+
+  // Gives the sample's PCM data, waiting for it's decode if it's not done yet
+  static Mix_Chunk *GetChunk(int id);
+
+  // Drops every held chunk, so they may be evicted from Resources. Ids stay valid
+  // No voice may be playing, and it may not be called during static destruction, when the bank itself may be gone (see Game::Shutdown)
+  static void Release();
+
+  // Memory taken by the held chunks
+  static size_t GetResidentBytes();
+
+private:
+  static std::vector<Sample> samples;
+
+  // Id of each registered path
+  static std::unordered_map<std::string, int> ids;
+};
+
+#endif
@@ -5,6 +5,7 @@
 #include <string>
 #include "SDL_image.h"
 #include "Rectangle.h"
+#include "TextureAtlas.h"
 #include "Game.h"
 
 // Holds parameters for configuring a sprite
@@ -30,11 +31,12 @@ class Sprite
 public:
   Sprite(const std::string initialTexture, SpriteConfig config = SpriteConfig());
 
+  // Gets the clip in the space of the texture returned by GetTexture, which may be an atlas page shared with other images
   SDL_Rect GetClip() const;
 
   std::shared_ptr<SDL_Texture> GetTexture() const;
 
-  // Sets which rectangle of the image is to be displayed
+  // Sets which rectangle of the image is to be displayed, relative to the image itself
   void SetClip(SDL_Rect rect);
 
   // Set the dimensions of the image to be displayed (in game units, NOT pixels)
@@ -60,13 +62,13 @@ private:
 
   SpriteConfig config;
 
-  // The loaded texture
-  std::shared_ptr<SDL_Texture> texture;
+  // The loaded image
+  std::shared_ptr<TextureAtlas::Region> image;
 
-  // Dimensions of the texture, in real pixels
+  // Dimensions of the image, in real pixels
   int width, height;
 
-  // The clipped rectangle of the image to be rendered
+  // The clipped rectangle of the image to be rendered, relative to the image
   SDL_Rect clipRect;
 };
 
@@ -0,0 +1,63 @@
+#ifndef __SPRITE_BATCH__
+#define __SPRITE_BATCH__
+
+#include <memory>
+#include <vector>
+#include <SDL.h>
+#include "Color.h"
+
+// Collects quads and records consecutive ones which share a texture as a single geometry command, drawn with one SDL_RenderGeometry call
+// Colors are baked into the vertices, so textures never need their color or alpha modulation changed
+// Quads are always drawn in the order they were queued. Anything else recorded in the frame's command list must call Flush first
+class SpriteBatch
+{
+public:
+  // How many quads were queued and how many draw calls were needed for them
+  struct Stats
+  {
+    // Quads queued, each of which used to be it's own draw call
+    int quads{0};
+
+    // Draw calls actually recorded
+    int drawCalls{0};
+  };
+
+  // Queues a quad with a clip of the texture
+  // Rotation is in degrees, clockwise around the destination's center, like SDL_RenderCopyEx
+  void Draw(const std::shared_ptr<SDL_Texture> &texture, const SDL_Rect &source, const SDL_FRect &destination,
+            Color color = Color::White(), double angle = 0, SDL_RendererFlip flip = SDL_FLIP_NONE);
+
+  // Queues a quad filled with a solid color
+  void Fill(const SDL_FRect &destination, Color color);
+
+  // Displaces every quad queued from now on by the given amount of pixels
+  void SetOffset(SDL_FPoint newOffset) { offset = newOffset; }
+
+  // Records all queued quads in the frame's command list
+  void Flush();
+
+  // Resets the stats, returning those of the frame that just ended
+  Stats EndFrame();
+
+  // Stats of the current frame so far
+  Stats GetStats() const;
+
+private:
+  // Queues the vertices of a quad, flushing first if it uses a different texture
+  void Push(const std::shared_ptr<SDL_Texture> &texture, const SDL_FRect &destination, SDL_FPoint uvMin, SDL_FPoint uvMax, SDL_Color color, double angle);
+
+  // Texture of the queued quads (nullptr for solid color)
+  std::shared_ptr<SDL_Texture> batchTexture;
+
+  // Dimensions of the batch texture, used to normalize clips
+  int textureWidth{1}, textureHeight{1};
+
+  SDL_FPoint offset{0, 0};
+
+  std::vector<SDL_Vertex> vertices;
+  std::vector<int> indices;
+
+  Stats stats;
+};
+
+#endif
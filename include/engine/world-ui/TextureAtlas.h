@@ -0,0 +1,75 @@
+#ifndef __TEXTURE_ATLAS__
+#define __TEXTURE_ATLAS__
+
+#include <memory>
+#include <vector>
+#include <SDL.h>
+
+// Packs images into a few large textures (pages) as they are loaded, so that sprites from different files can share a texture and be batched together
+// Pages are filled with shelves: rows as tall as their tallest image, into which images are placed left to right
+class TextureAtlas
+{
+public:
+  // Where an image ended up
+  struct Region
+  {
+    // Texture which holds the image
+    std::shared_ptr<SDL_Texture> texture;
+
+    // Rectangle of the texture occupied by the image
+    SDL_Rect rect;
+
+    // Whether the texture is a page shared with other images, whose memory the atlas accounts for
+    bool paged{false};
+  };
+
+  // Width and height of each page, in pixels
+  // Images that don't fit a page get a texture of their own
+  static const int pageSize;
+
+  // Uploads the image to a page with enough free space, creating one if necessary
+  Region Pack(SDL_Surface *image);
+
+  // Destroys pages which no longer have any regions in use
+  void ReleaseUnusedPages();
+
+  // How many pages currently exist
+  size_t PageCount() const { return pages.size(); }
+
+  // Memory taken by the pages
+  // A page's memory is only reclaimed once all of it's regions are gone, as shelf space is never reused
+  size_t GetResidentBytes() const { return pages.size() * size_t(pageSize) * pageSize * 4; }
+
+private:
+  struct Shelf
+  {
+    // Top of the shelf
+    int y;
+
+    int height;
+
+    // Where the next image goes in the shelf
+    int nextX;
+  };
+
+  struct Page
+  {
+    std::shared_ptr<SDL_Texture> texture;
+
+    std::vector<Shelf> shelves;
+
+    // Top of the next shelf to be opened
+    int nextShelfY{0};
+  };
+
+  // Finds room for an area of the given dimensions in the page, returning it's top left corner
+  // Returns false if there is no room
+  static bool Allocate(Page &page, int width, int height, SDL_Point &corner);
+
+  // Creates a new empty page
+  Page &NewPage();
+
+  std::vector<Page> pages;
+};
+
+#endif
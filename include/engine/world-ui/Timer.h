@@ -6,33 +6,68 @@
 
 // Allows storing timers in seconds
 // Timer always increase
+// Entries only remember when they were last started, and derive their value from a clock, so idle entries cost nothing per frame
 class Timer
 {
   struct Entry
   {
+    // Value at the moment the entry was last reset or stopped
     float value{0.0f};
+
+    // Clock time at which the entry was last reset or started
+    double startTime{0.0};
+
     bool enabled{false};
   };
 
   std::unordered_map<std::string, Entry> timers;
 
+  // Clock to follow, if any
+  const double *externalClock{nullptr};
+
+  // Clock advanced by Update, when there is no external one
+  double ownClock{0.0};
+
+  double Now() const { return externalClock != nullptr ? *externalClock : ownClock; }
+
 public:
+  // Creates a timer which follows it's own clock, advanced through Update
+  Timer() = default;
+
+  // Creates a timer which follows the given clock, in seconds
+  Timer(const double &clock) : externalClock(&clock) {}
+
   void
   Reset(std::string name, float value = 0, bool enable = true)
   {
-    timers[name].value = value;
-    timers[name].enabled = enable;
+    auto &entry = timers[name];
+    entry.value = value;
+    entry.startTime = Now();
+    entry.enabled = enable;
   }
-  float Get(std::string name) { return timers[name].value; }
-  void Start(std::string name) { timers[name].enabled = true; }
-  void Stop(std::string name) { timers[name].enabled = false; }
-  void Scrap(std::string name) { timers.erase(name); }
-  void Update(float deltaTime)
+  float Get(std::string name)
+  {
+    auto &entry = timers[name];
+    return entry.enabled ? entry.value + float(Now() - entry.startTime) : entry.value;
+  }
+  void Start(std::string name)
   {
-    for (auto &entry : timers)
-      if (entry.second.enabled)
-        entry.second.value += deltaTime;
+    auto &entry = timers[name];
+    if (entry.enabled)
+      return;
+    entry.startTime = Now();
+    entry.enabled = true;
   }
+  void Stop(std::string name)
+  {
+    auto &entry = timers[name];
+    entry.value = Get(name);
+    entry.enabled = false;
+  }
+  void Scrap(std::string name) { timers.erase(name); }
+
+  // Advances the timer's own clock. Has no effect when following an external clock
+  void Update(float deltaTime) { ownClock += deltaTime; }
 };
 
-#endif
\ No newline at end of file
+#endif
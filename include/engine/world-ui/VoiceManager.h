@@ -0,0 +1,97 @@
+#ifndef __VOICE_MANAGER__
+#define __VOICE_MANAGER__
+
+#include <cstdint>
+#include <vector>
+#include "SoundBank.h"
+
+// Assigns mixer channels to sample voices
+// Each category has a limit of voices, and when it (or the whole pool) is full the lowest priority, oldest voice is stolen, unless the new one has lower priority still
+// World voices are attenuated with their distance to the listener, and culled beyond cullDistance
+class VoiceManager
+{
+public:
+  // Identifies a playing voice. Stays unique after it finishes, so stale ids never touch newer voices
+  using VoiceId = int64_t;
+
+  static const VoiceId invalidVoice;
+
+  struct Stats
+  {
+    // Voices currently playing
+    int activeVoices{0};
+
+    // Size of the channel pool
+    int channelCount{0};
+
+    unsigned long played{0};
+
+    // Voices halted to make room for another
+    unsigned long stolen{0};
+
+    // Voices not played for being too far away
+    unsigned long culled{0};
+
+    // Voices not played for lack of a voice they could steal
+    unsigned long dropped{0};
+  };
+
+  // Allocates the mixer's channels
+  VoiceManager(int channelCount);
+
+  // Halts every voice
+  ~VoiceManager();
+
+  // Plays the sample the given times (0 loops it forever), at the given distance from the listener
+  // Returns invalidVoice if it was culled or dropped
+  VoiceId Play(int sample, int times = 1, float distance = 0);
+
+  void Stop(VoiceId voice);
+
+  void StopAll();
+
+  bool IsPlaying(VoiceId voice) const;
+
+  // Sets how many voices of the category may play at once
+  void SetCategoryLimit(SoundCategory category, int limit);
+
+  Stats GetStats() const;
+
+  // Distance (in units) from which world voices start fading
+  float fullVolumeDistance{15};
+
+  // Distance (in units) beyond which world voices aren't played
+  float cullDistance{40};
+
+private:
+  // What's playing on a channel
+  struct Voice
+  {
+    VoiceId id{invalidVoice};
+
+    SoundCategory category{SoundCategory::Effect};
+
+    int priority{0};
+
+    // Order in which voices started
+    unsigned long startedAt{0};
+  };
+
+  // Whether the channel's voice is still playing
+  bool IsActive(int channel) const;
+
+  // Channel of the lowest priority, oldest active voice of the category (or of any category, if it's null). Returns -1 if there is none
+  int FindStealable(const SoundCategory *category) const;
+
+  // Voice on each channel
+  std::vector<Voice> voices;
+
+  // Voice limit of each category
+  std::vector<int> categoryLimits;
+
+  unsigned long nextVoice{0};
+
+  Stats stats;
+};
+
+#endif
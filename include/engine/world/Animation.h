@@ -4,6 +4,8 @@
 #include "AnimationFrame.h"
 #include "Event.h"
 #include <string>
+#include <memory>
+#include <vector>
 
 class Animator;
 
@@ -67,6 +69,9 @@ public:
   // Id of this animation
   int id{idGenerator++};
 
+  // Frame tables shared by every animation an animator builds from the same registration, one per variant
+  typedef std::vector<std::shared_ptr<const std::vector<AnimationFrame>>> FrameTables;
+
   // === ANIMATION SPECIFICITIES
 
   // Instances need their animator
@@ -86,9 +91,13 @@ public:
   virtual float &SpeedModifier();
 
 protected:
-  // Provides an initial value to the frames
+  // Provides the frames, which are shared with the other animations built from the same registration
+  // It's only called by the first of them to play each variant, so it must not capture the instance (see AnimationFrame::AddCallback)
   virtual std::vector<AnimationFrame> InitializeFrames() = 0;
 
+  // Which of the shared frame tables this animation plays. Animations whose frames depend on their state give each state it's own variant
+  virtual size_t GetFramesVariant() const { return 0; }
+
 private:
   // Used in default implementation
   float speedModifier{1};
@@ -99,13 +108,23 @@ private:
   // === FRAMES
 public:
   // Each and every animation frame, to be played sequentially
-  std::vector<AnimationFrame> &Frames();
+  const std::vector<AnimationFrame> &Frames();
 
   // Gets a specific frame
-  AnimationFrame &GetFrame(int frame);
+  const AnimationFrame &GetFrame(int frame);
+
+  // Adds a callback to the frame which only this animation triggers
+  void AddCallback(int frame, std::function<void(WorldObject &)> callback);
 
 private:
-  std::vector<AnimationFrame> frames;
+  // Tables shared with the other animations built from the same registration (nullptr until needed, if not built by an animator)
+  std::shared_ptr<FrameTables> frameTables;
+
+  // Table this animation plays, resolved the first time it's needed
+  std::shared_ptr<const std::vector<AnimationFrame>> frames;
+
+  // Callbacks only this animation triggers, along with their frame's index
+  std::vector<std::pair<int, std::function<void(WorldObject &)>>> instanceCallbacks;
 
   // === SEQUENCE CONTROL
 protected:
@@ -150,19 +169,32 @@ private:
 
   bool finished{false};
 
+  // Animator to which events are propagated
+  std::weak_ptr<Animator> weakAnimator;
+
   // === HELPERS
 public:
   // Access frames directly
-  AnimationFrame &operator[](int index);
+  const AnimationFrame &operator[](int index);
 
   // Allow inherited classes to add functionality to update
   virtual void OnUpdate(float) {}
 
   // Automatically generates the frame vector for a spritesheet animation
   // Allows offsetting the frames by some virtual pixels
+  // Slices are cached, so slicing the same sheet the same way again only copies the frames
   static std::vector<AnimationFrame> SliceSpritesheet(
       std::string filename, SpritesheetClipInfo clipInfo, float frameDuration, Vector2 virtualPixelOffset = Vector2::Zero(), SpriteConfig config = SpriteConfig());
 
+  // Releases every cached slice, so that their sprites may be freed
+  static void ClearSliceCache();
+
+private:
+  // Slices without looking at the cache
+  static std::vector<AnimationFrame> SliceSpritesheetUncached(
+      std::string filename, SpritesheetClipInfo clipInfo, float frameDuration, Vector2 virtualPixelOffset, SpriteConfig config);
+
+public:
   // Reference to it's animator
   Animator &animator;
 };
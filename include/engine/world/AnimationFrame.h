@@ -8,6 +8,7 @@
 #include "Sprite.h"
 
 class WorldObject;
+class Animation;
 
 class AnimationFrame
 {
@@ -24,6 +25,10 @@ public:
   // Add a callback behavior
   void AddCallback(std::function<void(WorldObject &)> callback);
 
+  // Add a callback behavior which acts on the animation playing the frame
+  // Frames are shared by every animation built from the same registration, so callbacks must get the animation this way instead of capturing it
+  void AddCallback(std::function<void(WorldObject &, Animation &)> callback);
+
   // Add a sprite behavior (there can only be one at a time, a previous one will be overwritten)
   void SetSprite(std::shared_ptr<Sprite> sprite);
 
@@ -31,7 +36,7 @@ public:
   std::shared_ptr<Sprite> GetSprite() const;
 
   // Triggers all of this frame's behaviors
-  void Trigger(WorldObject &worldObject) const;
+  void Trigger(WorldObject &worldObject, Animation &animation) const;
 
   // Get this frame's default duration
   float GetDuration() const;
@@ -42,7 +47,7 @@ public:
 
 private:
   // All the callbacks triggered by this frame
-  std::vector<std::function<void(WorldObject &)>> callbacks;
+  std::vector<std::function<void(WorldObject &, Animation &)>> callbacks;
 
   // A sprite to be set by this frame
   std::shared_ptr<Sprite> sprite;
@@ -41,9 +41,15 @@ public:
   // Tries to lock it's rigidbody component, and throws if it's expired
   std::shared_ptr<Rigidbody> RequireRigidbody() const;
 
+  // Resolves it's rigidbody component, or nullptr if it has none
+  Rigidbody *GetRigidbody() const;
+
   // Id of object under which this collider is registered
   int GetOwnerId() const;
 
+  // Resolves the object under which this collider is registered, or nullptr if it's not registered
+  WorldObject *ResolveOwner() const;
+
   // Get the associated shape, already rotated, scaled and displaced to this worldObject's scale, rotation and position
   std::shared_ptr<Shape> DeriveShape() const;
 
@@ -69,6 +75,10 @@ protected:
 private:
   // Id of the owner worldObject
   int ownerId;
+
+  // Handles to the owner worldObject and to the rigidbody
+  Handle ownerHandle;
+  Handle rigidbodyHandle;
 };
 
 #include "SpriteRenderer.h"
@@ -3,6 +3,7 @@
 
 #include "Rectangle.h"
 #include "Helper.h"
+#include "Handle.h"
 #include <iostream>
 #include <utility>
 #include <memory>
@@ -25,13 +26,21 @@ public:
     float penetration;
 
     // Collider of object that received contact
-    std::weak_ptr<Collider> weakSource;
+    Handle source;
 
     // Collider of object that made contact
-    std::weak_ptr<Collider> weakOther;
+    Handle other;
+
+    // Resolve the colliders, returning nullptr if they were destroyed
+    Collider *GetSource() const;
+    Collider *GetOther() const;
+
+    // Resolve the colliders and throw if they were destroyed
+    Collider &RequireSource() const;
+    Collider &RequireOther() const;
 
     // Returns a number which is unique for each pair of (source, other) colliders (order matters)
-    size_t GetHash() const;
+    uint64_t GetHash() const;
   };
 
   // Finds the minimum distance between both shape's edges
@@ -56,6 +56,7 @@ public:
   void Start() override;
   void PhysicsUpdate(float deltaTime) override;
   void Render() override;
+  void OnBeforeDestroy() override;
   RenderLayer GetRenderLayer() override { return renderLayer; }
   int GetRenderOrder() override { return renderOrder; }
 
@@ -102,8 +103,8 @@ private:
   // Get the particle system
   ParticleSystem &GetSystem() const;
 
-  // Gets a list of all active particles emitted by this emitter
-  std::list<std::shared_ptr<Particle>> GetEmittedParticles();
+  // Gets this emitter's slot in the particle system, registering it if necessary
+  int GetSystemSlot();
 
   // Whether is currently emitting
   bool active{false};
@@ -114,8 +115,8 @@ private:
   // Time until next emission
   float emitCooldown{0};
 
-  // Which particles it has emitted
-  std::list<std::weak_ptr<Particle>> weakEmittedParticles;
+  // Slot in the particle system which identifies this emitter's particles (-1 if not registered yet)
+  int systemSlot{-1};
 
   // Layer to render to
   RenderLayer renderLayer;
@@ -4,34 +4,94 @@
 #include "Vector2.h"
 #include "Color.h"
 #include "Particle.h"
-#include <memory>
-#include <unordered_map>
+#include "Handle.h"
+#include <vector>
 
 class GameScene;
 
+// Fixed capacity pool of particles, with each field stored in it's own array so they can be integrated in tight loops
+// Dead particles are replaced by the last alive one, so alive particles are always packed at the start of the arrays
+// Each particle belongs to an emitter slot, which provides it's time scale and behavior
 class ParticleSystem
 {
-  friend class Particle;
-
 public:
+  // How many particles can be alive at once. Particles created beyond it are dropped
+  static const int capacity;
+
   ParticleSystem(GameScene &gameScene);
 
   void PhysicsUpdate(float deltaTime);
 
-  // Deletes a particle
-  void DeleteParticle(int id);
+  // Registers an emitter whose particles follow the given object's time scale
+  // Returns the emitter's slot, which identifies it's particles
+  int RegisterEmitter(Handle referenceObject);
+
+  // Lets go of an emitter slot. It's particles still live out their lifetimes
+  void ReleaseEmitter(int slot);
+
+  // Sets the behavior which is applied to the slot's particles each physics frame
+  void SetBehavior(int slot, Particle::behavior_callback behavior);
+
+  // Creates a particle for the given slot
+  // Returns false if the pool is full
+  bool CreateParticle(int slot, Vector2 position, float lifetime, Vector2 velocity = Vector2::Zero(), Color color = Color::White(), Vector2 gravityModifier = Vector2::Zero());
 
-  // Creates a particle
-  std::shared_ptr<Particle> CreateParticle(Vector2 position, float lifetime, Vector2 velocity = Vector2::Zero(), Color color = Color::White(), Vector2 gravityModifier = Vector2::Zero(), Particle::behavior_callback behavior = nullptr);
+  // Renders the slot's particles which are in view
+  void Render(int slot);
+
+  // How many particles are alive
+  int Count() const { return count; }
 
 private:
+  struct EmitterSlot
+  {
+    // Object whose time scale is used
+    Handle referenceObject;
+
+    Particle::behavior_callback behavior;
+
+    // How many alive particles belong to it
+    int particleCount{0};
+
+    // Whether it's emitter let go of it. It's only reused once it's particles are gone
+    bool released{false};
+  };
+
+  // Removes the particle at the given index, moving the last one in it's place
+  void Remove(int index);
+
+  // Groups particle indices by slot, for rendering
+  void Group();
+
   GameScene &gameScene;
 
-  // Particle id generator
-  int nextId{0};
+  // How many particles are alive
+  int count{0};
+
+  // === PARTICLE FIELDS
+
+  std::vector<float> positionX, positionY;
+  std::vector<float> velocityX, velocityY;
+  std::vector<float> gravityModifierX, gravityModifierY;
+  std::vector<float> lifetimes;
+  std::vector<Color> colors;
+  std::vector<int> particleSlots;
+
+  // === EMITTERS
+
+  std::vector<EmitterSlot> slots;
+
+  // Delta time of each slot in the current physics frame
+  std::vector<float> slotDeltaTimes;
+
+  // Particle indices grouped by slot
+  std::vector<int> groupedIndices;
+
+  // Where each slot's group begins in groupedIndices (with an extra entry marking the end of the last one)
+  std::vector<int> groupStarts;
 
-  // Store all particles
-  std::unordered_map<int, std::shared_ptr<Particle>> particles;
+  // Whether groups reflect the current particles
+  bool groupsValid{false};
 };
 
-#endif
\ No newline at end of file
+#endif
@@ -22,7 +22,7 @@ struct RaycastData
   float elapsedDistance;
 
   // The collider with which collision happened
-  std::weak_ptr<Collider> other;
+  Handle other;
 };
 
 // Stores data on a collider cast collision
@@ -81,29 +81,33 @@ public:
   // Deletes the colliders associated to this object ID
   void UnregisterColliders(int objectId);
 
+  // Deletes the colliders associated to each of these object IDs
+  void UnregisterObjects(const std::vector<int> &objectIds);
+
 private:
-  using ValidatedColliders = std::vector<std::shared_ptr<Collider>>;
-  using WeakColliders = std::vector<std::weak_ptr<Collider>>;
+  // Colliders are referred to by handle, and only resolved where they are used
+  // This way no reference counts are touched, and colliders destroyed mid-frame are simply skipped
+  using ColliderHandles = std::vector<Handle>;
 
   // Pass each object through ValidateColliders and collect the results in a shuffled vector
-  auto ValidateAllColliders(std::unordered_map<int, WeakColliders> &) -> std::vector<ValidatedColliders>;
+  auto ValidateAllColliders(std::unordered_map<int, ColliderHandles> &) -> std::vector<ColliderHandles>;
 
-  auto ValidateAllColliders(std::unordered_map<int, std::weak_ptr<Collider>> &) -> std::vector<std::shared_ptr<Collider>>;
+  auto ValidateAllColliders(std::unordered_map<int, Handle> &) -> ColliderHandles;
 
-  // For a specific object, removes any expired colliders from structure & returns the remaining ones as shared
-  ValidatedColliders ValidateColliders(int id, WeakColliders &colliders);
+  // For a specific object, removes any expired colliders from structure & returns the remaining ones
+  ColliderHandles ValidateColliders(int id, ColliderHandles &colliders);
 
   // Structure that maps each dynamic body object id to the list of it's colliders
-  std::unordered_map<int, WeakColliders> dynamicColliderStructure;
+  std::unordered_map<int, ColliderHandles> dynamicColliderStructure;
 
   // Structure that maps each kinematic body object id to the list of it's colliders
-  std::unordered_map<int, WeakColliders> kinematicColliderStructure;
+  std::unordered_map<int, ColliderHandles> kinematicColliderStructure;
 
   // Structure that maps each static body object id to the list of it's colliders
-  std::unordered_map<int, WeakColliders> staticColliderStructure;
+  std::unordered_map<int, ColliderHandles> staticColliderStructure;
 
   // Structure that maps each trigger collider id to itself
-  std::unordered_map<int, std::weak_ptr<Collider>> weakTriggerColliders;
+  std::unordered_map<int, Handle> triggerColliders;
 
   // =================================
   // PHYSICS OPERATIONS
@@ -125,15 +129,18 @@ public:
   // Returns whether a group of colliders collides with any body when cast from the given position in some direction, over a fixed distance
   // Populates the raycast collision struct if a collision is detected
   // Allows filtering collisions with a CollisionFilter
-  bool ColliderCast(std::vector<std::shared_ptr<Collider>> colliders, Vector2 origin, float angle, float maxDistance, ColliderCastData &data, CollisionFilter filter = CollisionFilter(), float colliderSizeScale = 1);
-  bool ColliderCast(std::vector<std::shared_ptr<Collider>> colliders, Vector2 origin, float angle, float maxDistance, CollisionFilter filter = CollisionFilter(), float colliderSizeScale = 1);
+  bool ColliderCast(const std::vector<std::shared_ptr<Collider>> &colliders, Vector2 origin, float angle, float maxDistance, ColliderCastData &data, const CollisionFilter &filter = CollisionFilter(), float colliderSizeScale = 1);
+  bool ColliderCast(const std::vector<std::shared_ptr<Collider>> &colliders, Vector2 origin, float angle, float maxDistance, const CollisionFilter &filter = CollisionFilter(), float colliderSizeScale = 1);
 
 private:
+  // Collider cast for colliders which are already referred to by handle
+  bool ColliderCast(const ColliderHandles &colliders, Vector2 origin, float angle, float maxDistance, ColliderCastData &data, const CollisionFilter &filter, float colliderSizeScale);
+
   // Returns whether detected a collision between the given particle and any bodies
-  bool DetectRaycastCollisions(Vector2 particle, RaycastData &data, CollisionFilter filter);
+  bool DetectRaycastCollisions(Vector2 particle, RaycastData &data, const CollisionFilter &filter);
 
   // Returns whether detected a collision between the given colliders and any bodies
-  bool DetectColliderCastCollisions(std::vector<std::shared_ptr<Collider>> colliders, Vector2 position, ColliderCastData &data, CollisionFilter filter, float colliderSizeScale);
+  bool DetectColliderCastCollisions(const ColliderHandles &colliders, Vector2 position, ColliderCastData &data, const CollisionFilter &filter, float colliderSizeScale);
 
   // =================================
   // COLLISION DETECTION
@@ -143,25 +150,53 @@ private:
   void HandleCollisions();
 
   // Normal collision detection for an object
-  void DetectObjectCollisions(std::vector<ValidatedColliders>::iterator objectIterator, std::vector<ValidatedColliders>::iterator endIterator, std::vector<ValidatedColliders> &staticColliders);
+  void DetectObjectCollisions(std::vector<ColliderHandles>::iterator objectIterator, std::vector<ColliderHandles>::iterator endIterator, std::vector<ColliderHandles> &staticColliders);
 
   // Continuous collision detection for an object
-  void DetectObjectBetweenFramesCollision(std::vector<ValidatedColliders>::iterator objectIterator);
+  void DetectObjectBetweenFramesCollision(std::vector<ColliderHandles>::iterator objectIterator);
 
   // Checks if there is collision between the two collider lists. If there is, populates the collisionData struct
   // Last 2 parameters are useful when this function is used by collider casts
   bool CheckForCollision(
-      std::vector<std::shared_ptr<Collider>> colliders1, std::vector<std::shared_ptr<Collider>> colliders2, Collision::Data &collisionData, Vector2 displaceColliders1 = Vector2::Zero(), float scaleColliders1 = 1);
+      const ColliderHandles &colliders1, const ColliderHandles &colliders2, Collision::Data &collisionData, Vector2 displaceColliders1 = Vector2::Zero(), float scaleColliders1 = 1);
+
+  // Whether the owners of both colliders are in the same lineage
+  static bool SameLineage(Handle collider1, Handle collider2);
+
+  // Resolves the rigidbody of the first valid collider in the list, or nullptr if there's none
+  static Rigidbody *ResolveBody(const ColliderHandles &colliders);
 
   // Applies impulse, checks if collision is entering & announces regular collision
-  void ResolveCollision(Collision::Data collisionData);
+  void ResolveCollision(const Collision::Data &collisionData);
 
   // Checks if collision is entering & announces regular collision
-  void ResolveTriggerCollision(std::shared_ptr<Collider> collider1, std::shared_ptr<Collider> collider2);
+  void ResolveTriggerCollision(Handle collider1, Handle collider2);
 
   // This system's collision layer handler
   PhysicsLayerHandler layerHandler;
 
+  // =================================
+  // DEBUG OVERLAY
+  // =================================
+public:
+  // Whether to draw every collider and the contacts of the last physics frame
+  bool showOverlay{false};
+
+  // Queues debug drawings of every collider, colored by body type, and of the last physics frame's contact normals
+  void DrawOverlay();
+
+private:
+  struct OverlayContact
+  {
+    // Midpoint between both colliders
+    Vector2 position;
+
+    Vector2 normal;
+  };
+
+  // Contacts resolved in the last physics frame, only collected while the overlay is shown
+  std::vector<OverlayContact> overlayContacts;
+
   // =================================
   // UTILITY
   // =================================
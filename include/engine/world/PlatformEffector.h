@@ -20,7 +20,7 @@ public:
   void PhysicsUpdate(float) override;
 
   // Whether the given body should or not be allowed to not collide with this platform at this frame
-  bool AllowThrough(std::shared_ptr<Rigidbody> body);
+  bool AllowThrough(const Rigidbody &body);
 
   // As long as the given body is whitelisted, it will never collide with this platform
   void Whitelist(std::shared_ptr<Rigidbody> body);
@@ -30,10 +30,10 @@ public:
 
 private:
   // Whether the given body's velocity is within the allowed arc
-  bool IsBodyInArc(std::shared_ptr<Rigidbody> body);
+  bool IsBodyInArc(const Rigidbody &body);
 
   // Registers a body as being allowed through in this frame
-  void RegisterAllowedBody(std::shared_ptr<Rigidbody> body);
+  void RegisterAllowedBody(const Rigidbody &body);
 
   // (In radians) Arc through which, if a body's velocity is within, it will be allowed to pass through
   std::pair<float, float> passThroughArc;
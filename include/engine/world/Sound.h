@@ -7,6 +7,7 @@
 #include "WorldObject.h"
 #include "WorldComponent.h"
 #include "Helper.h"
+#include "VoiceManager.h"
 
 class Sound : public WorldComponent
 {
@@ -17,22 +18,29 @@ public:
   // Ensure sound stops if destroyed
   virtual ~Sound() { Stop(); }
 
-  // Adds an audio
-  void AddAudio(std::string sound, std::string path);
+  // Adds an audio, returning it's sample id
+  int AddAudio(std::string sound, std::string path, SoundCategory category = SoundCategory::Effect, int priority = 0);
 
-  // Plays audio
-  void Play(std::string sound, int times = 1);
+  // Gets the sample id of an added audio
+  int GetSample(std::string sound) const;
+
+  // Plays audio at this object's position
+  void Play(int sample, int times = 1);
+  void Play(std::string sound, int times = 1) { Play(GetSample(sound), times); }
 
   // Stops a single sound
-  void Stop(std::string sound);
+  void Stop(int sample);
+  void Stop(std::string sound) { Stop(GetSample(sound)); }
 
   // Stops playing all sounds
   void Stop();
 
 private:
-  std::unordered_map<std::string, std::string> sounds;
-  std::unordered_map<std::string, std::shared_ptr<Mix_Chunk>> chunks;
-  std::unordered_map<std::string, int> channels;
+  // Sample id of each added audio
+  std::unordered_map<std::string, int> samples;
+
+  // Voices this started, along with their sample
+  std::vector<std::pair<int, VoiceManager::VoiceId>> voices;
 };
 
-#endif
\ No newline at end of file
+#endif
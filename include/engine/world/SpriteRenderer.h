@@ -40,6 +40,8 @@ public:
   int GetRenderOrder() override { return renderOrder; }
   void SetRenderOrder(int newOrder);
 
+  bool GetWorldBounds(Rectangle &bounds) override;
+
   Vector2 GetOffset() const;
 
   void SetOffset(Vector2 newOffset);
@@ -71,16 +73,12 @@ public:
   // Set a parallax modifier for the renderer
   void SetParallax(float parallax, float referenceCameraSize);
 
-private:
-  // Allows a procedure to operate with a texture from sprite with color alterations already applied to it
-  void UseTexture(std::function<void(SDL_Texture *)> procedure);
+  float GetParallax() const;
 
+private:
   // Apply parallax to a given position
   Vector2 ApplyParallax(Vector2 position) const;
 
-  // Last texture generated by generate texture
-  SDL_Texture *lastTexture{nullptr};
-
   // Which sprite is currently loaded
   std::shared_ptr<Sprite> sprite;
 
@@ -2,16 +2,26 @@
 #define __TRIGGER_COLLISION_DATA__
 
 #include <memory>
+#include "Handle.h"
 
 class Collider;
 
 struct TriggerCollisionData
 {
-  std::weak_ptr<Collider> weakSource;
+  Handle source;
 
-  std::weak_ptr<Collider> weakOther;
+  Handle other;
 
-  size_t GetHash() const;
+  // Resolve the colliders, returning nullptr if they were destroyed
+  Collider *GetSource() const;
+  Collider *GetOther() const;
+
+  // Resolve the colliders and throw if they were destroyed
+  Collider &RequireSource() const;
+  Collider &RequireOther() const;
+
+  // Returns a number which is unique for each pair of (source, other) colliders (order matters)
+  uint64_t GetHash() const;
 };
 
 #endif
\ No newline at end of file
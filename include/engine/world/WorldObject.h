@@ -30,9 +30,6 @@ public:
   // FRAME EVENTS
   // =================================
 public:
-  // Add: Confine objects to limited game space
-  void Update(float deltaTime) override;
-
   // Add: Detect collision exits
   void PhysicsUpdate(float deltaTime) override;
 
@@ -40,7 +37,7 @@ public:
   // DESTRUCTION
   // =================================
 public:
-  // How far from origin an object can get in either coordinates before being destroyed
+  // How far from origin a body can get in either coordinates before being destroyed
   static const float objectCollectionRange;
 
 protected:
@@ -103,11 +100,10 @@ public:
   void SetParent(std::shared_ptr<WorldObject> newParent);
 
   // Check if this worldObject is in the descendant lineage of the other object
-  bool IsDescendantOf(std::shared_ptr<WorldObject> other) const;
+  bool IsDescendantOf(const WorldObject &other) const;
 
   // Check if either object is a descendent of each other
-  static bool SameLineage(
-      std::shared_ptr<WorldObject> first, std::shared_ptr<WorldObject> second);
+  static bool SameLineage(const WorldObject &first, const WorldObject &second);
 
   // Executes the given function for this object and then cascades it down to any children it has
   void CascadeDown(std::function<void(GameObject &)> callback, bool topDown = true) override;
@@ -123,6 +119,9 @@ protected:
   // Gets pointer to parent, cast to world object
   std::shared_ptr<WorldObject> InternalGetWorldParent() const;
 
+  // Resolves parent handle, cast to world object. Raises when called from root object
+  WorldObject &ResolveWorldParent() const;
+
 private:
   // Parent object
   std::weak_ptr<WorldObject> weakParent;
@@ -132,36 +131,36 @@ private:
   // =================================
 public:
   // Announces collision to all components
-  void OnCollision(Collision::Data collisionData);
-  void OnCollisionEnter(Collision::Data collisionData);
-  void OnCollisionExit(Collision::Data collisionData);
+  void OnCollision(const Collision::Data &collisionData);
+  void OnCollisionEnter(const Collision::Data &collisionData);
+  void OnCollisionExit(const Collision::Data &collisionData);
 
   // Whether collision with the given collider happened THIS frame
-  bool IsCollidingWith(std::shared_ptr<Collider> collider);
+  bool IsCollidingWith(const Collider &collider);
 
   // Whether collision with the given body happened last frame
-  bool WasCollidingWith(std::shared_ptr<Collider> collider);
+  bool WasCollidingWith(const Collider &collider);
 
-  bool CollisionDealtWith(Collision::Data collisionData);
-  bool CollisionDealtWithLastFrame(Collision::Data collisionData);
+  bool CollisionDealtWith(const Collision::Data &collisionData);
+  bool CollisionDealtWithLastFrame(const Collision::Data &collisionData);
 
   // Announces trigger collision to all components
-  void OnTriggerCollision(TriggerCollisionData triggerData);
-  void OnTriggerCollisionEnter(TriggerCollisionData triggerData);
-  void OnTriggerCollisionExit(TriggerCollisionData triggerData);
+  void OnTriggerCollision(const TriggerCollisionData &triggerData);
+  void OnTriggerCollisionEnter(const TriggerCollisionData &triggerData);
+  void OnTriggerCollisionExit(const TriggerCollisionData &triggerData);
 
   // Whether collision with the given collider happened THIS frame
-  bool IsTriggerCollidingWith(std::shared_ptr<Collider> collider);
+  bool IsTriggerCollidingWith(const Collider &collider);
 
   // Whether collision with the given body happened last frame
-  bool WasTriggerCollidingWith(std::shared_ptr<Collider> collider);
+  bool WasTriggerCollidingWith(const Collider &collider);
 
-  bool TriggerCollisionDealtWith(TriggerCollisionData triggerData);
-  bool TriggerCollisionDealtWithLastFrame(TriggerCollisionData triggerData);
+  bool TriggerCollisionDealtWith(const TriggerCollisionData &triggerData);
+  bool TriggerCollisionDealtWithLastFrame(const TriggerCollisionData &triggerData);
 
   // Raises all Exit messages on both sides of the collider's current interactions
   // Should be called when the given collider is about to be destroyed
-  void HandleColliderDestruction(std::shared_ptr<Collider> collider);
+  void HandleColliderDestruction(const Collider &collider);
 
 private:
   // Verifies which collisions & triggers have exited this frame and raises them
@@ -174,13 +173,13 @@ private:
   bool inheritedPhysicsLayer{true};
 
   // Keeps track of all collisions registered this frame
-  std::unordered_map<size_t, Collision::Data> frameCollisions;
+  std::unordered_map<uint64_t, Collision::Data> frameCollisions;
 
   // Keeps track of all collisions registered last frame
   decltype(frameCollisions) lastFrameCollisions;
 
   // Keeps track of all triggers registered this frame
-  std::unordered_map<size_t, TriggerCollisionData> frameTriggers;
+  std::unordered_map<uint64_t, TriggerCollisionData> frameTriggers;
 
   // Keeps track of all triggers registered last frame
   decltype(frameTriggers) lastFrameTriggers;
@@ -25,6 +25,9 @@ public:
   Music music;
   Music background;
 
+protected:
+  void DeclareAssets(AssetManifest &manifest) override;
+
 private:
   void SpawnCharacters();
 
@@ -62,6 +62,9 @@ private:
   // Player associated to this character
   std::weak_ptr<Player> weakPlayer;
 
+  // Keeps control enabling subscribed to the arena's battle start
+  EventSubscription battleStartSubscription;
+
   Vector2 lastVelocity;
 
   Invulnerability &invulnerability;
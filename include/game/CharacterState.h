@@ -18,7 +18,7 @@ public:
   CharacterState(std::string name, int priority, std::shared_ptr<Action> parentAction = nullptr);
 
   // When this condition is met, the state should be removed
-  bool RemoveRequested(std::shared_ptr<CharacterStateManager>);
+  bool RemoveRequested(CharacterStateManager &);
 
   // Register action input as released
   void ReleaseActionInput();
@@ -46,13 +46,13 @@ public:
   std::shared_ptr<Action> parentAction;
 
   // State removal condition callback
-  std::function<bool(std::shared_ptr<CharacterStateManager>)> removeCondition{nullptr};
+  std::function<bool(CharacterStateManager &)> removeCondition{nullptr};
 
   // Callback to trigger on state add
-  std::function<void(std::shared_ptr<CharacterStateManager>)> onAdd{nullptr};
+  std::function<void(CharacterStateManager &)> onAdd{nullptr};
 
   // Callback to trigger on state remove
-  std::function<void(std::shared_ptr<CharacterStateManager>)> onRemove{nullptr};
+  std::function<void(CharacterStateManager &)> onRemove{nullptr};
 
   // Whether this state can be interrupted by an action of the same type of parent regardless of priority
   bool openToSequence{false};
@@ -130,7 +130,10 @@ public:
   std::shared_ptr<CharacterStateManager> GetSharedCasted() const;
 
 private:
-  std::weak_ptr<Rigidbody> weakBody;
+  // Resolves the body handle, and throws if it's no longer valid
+  Rigidbody &RequireBody() const;
+
+  Handle bodyHandle;
 };
 
 #endif
\ No newline at end of file
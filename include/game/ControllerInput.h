@@ -27,8 +27,8 @@ private:
   // To which player this controller input is bound
   const std::weak_ptr<Player> weakPlayer;
 
-  // The unique callback identifier for this controller
-  std::string callbackIdentifier;
+  // Keeps controller listeners subscribed
+  std::vector<EventSubscription> inputSubscriptions;
 };
 
 #endif
\ No newline at end of file
@@ -70,6 +70,9 @@ private:
 
   bool fallen{false};
 
+  // Token of the scheduled respawn
+  int respawnToken{0};
+
   Invulnerability &invulnerability;
   Sound &sound;
 };
@@ -72,6 +72,10 @@ private:
   std::weak_ptr<TimeScaleManager> weakTimeScaleManager;
   std::weak_ptr<ShakeEffectManager> weakShakeManager;
   std::weak_ptr<Sound> weakSound;
+
+  // Sample ids of the sounds a hit picks from
+  std::vector<int> punchSamples;
+  std::vector<int> gruntSamples;
 };
 
 #endif
\ No newline at end of file
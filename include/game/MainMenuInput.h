@@ -102,7 +102,8 @@ private:
   // Selection badges for each player to take as they connect
   std::queue<std::pair<std::string, std::string>> playerBadges;
 
-  std::string callbackIdentifier;
+  // Keeps input manager listeners subscribed
+  std::vector<EventSubscription> inputSubscriptions;
 };
 
 #endif
\ No newline at end of file
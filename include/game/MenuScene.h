@@ -25,6 +25,9 @@ public:
 
   void InitializeObjects() override;
 
+protected:
+  void DeclareAssets(AssetManifest &manifest) override;
+
 private:
   // Create the splash menu
   void CreateSplash(std::shared_ptr<UIContainer> mainContainer);
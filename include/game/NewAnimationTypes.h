@@ -13,7 +13,7 @@ class StatefulAnimation : public Animation
 {
 public:
   StatefulAnimation(Animator &animator);
-  virtual ~StatefulAnimation();
+  virtual ~StatefulAnimation() {}
 
   // Register the state
   void RegisterState(std::shared_ptr<CharacterState> actionState);
@@ -49,6 +49,10 @@ protected:
   virtual void OnParentActionInputRelease();
 
   std::weak_ptr<CharacterState> weakActionState;
+
+private:
+  // Keeps this animation listening to the state's input release
+  EventSubscription inputReleaseSubscription;
 };
 
 // A stateful animation that specifically performs an attack with hitboxes
@@ -63,7 +67,7 @@ public:
   virtual float GetHitCooldown() const;
 
   // Sets hitbox for a given frame
-  void FrameHitbox(AnimationFrame &frame, std::vector<Circle> hitboxAreas = {});
+  static void FrameHitbox(AnimationFrame &frame, std::vector<Circle> hitboxAreas = {});
 
 protected:
   // Setup attack properties
@@ -153,6 +157,9 @@ protected:
   // Takes full responsibility over this method
   std::vector<AnimationFrame> InitializeFrames() final override;
 
+  // Each phase has it's own frames
+  size_t GetFramesVariant() const final override;
+
   // Takes full responsibility over this method
   std::shared_ptr<StatefulAnimation> GetNextStateful() final override;
 
@@ -186,6 +193,10 @@ private:
 
   // How long the inner loop animation has ran for
   float innerLoopElapsedTime{0};
+
+  // Listeners this phase adds to it's own events, which must not be passed on to the next phase
+  ListenerId sequenceStopCheckListener{0};
+  ListenerId endBehaviorListener{0};
 };
 
 class RiposteAnimation : public AttackAnimation
@@ -74,6 +74,9 @@ struct ShakeEffect
 
   // Whether manager should destroy this next update
   bool destroyRequested{false};
+
+  // Keeps original offset up to date with the renderer's
+  EventSubscription offsetSubscription;
 };
 
 class ShakeEffectManager : public WorldComponent
@@ -6,9 +6,43 @@
 // Allows for printing frames' (and physics frames) duration in the console
 // #define PRINT_FRAME_DURATION
 
+// Allows for printing how many quads were rendered each frame (each of which used to take a draw call), how many draw calls were actually issued for them, how many things were culled, and how many renderer state changes were not redundant
+// #define PRINT_DRAW_CALLS
+
 // Allows for displaying how many frames (and physics frames) have actually been processed each second, in the top left corner
 #define DISPLAY_REAL_FPS
 
+// Allows for printing percentiles of the latest frame intervals each second, to spot uneven pacing
+// #define PRINT_FRAME_PACING
+
+// Allows for timing profiler zones on every thread, and exporting the latest ones as a Chrome trace with F4 (and at the end of headless runs)
+// #define PROFILE_FRAMES
+
+// Allows for adding up the cost of each component type's phases, printed and exported as CSV when each scene is destroyed
+// #define PROFILE_COMPONENTS
+
+// === RENDERING
+
+// Executes & presents each frame on a dedicated render thread, while the next frame is simulated
+// #define RENDER_THREAD
+
+// Presents on vsync, and paces frames at the whole number of display refreshes closest to the frame rate
+// #define VSYNC_PACING
+
+// Allows toggling an overlay of every collider and of the last physics frame's contact normals with F3
+// #define PHYSICS_OVERLAY
+
+// === ASSETS
+
+// Records which assets each scene uses into a manifest next to the assets, so that the next run preloads them before the scene starts
+// #define RECORD_ASSET_MANIFESTS
+
+// Allows for printing how long it took from startup to the first frame, and whether assets were read from the archive or from loose files
+// #define PRINT_STARTUP_TIME
+
+// Allows for printing the hits, misses, evictions and resident memory of each resource type's cache whenever it's trimmed
+// #define PRINT_RESOURCE_STATS
+
 // === COLLISION MATRIX
 
 // When defined, allows for printing the collision matrix on game scene construction
@@ -0,0 +1,49 @@
+#include "Clock.h"
+#include <algorithm>
+
+using namespace std;
+
+Uint64 Clock::sleepEstimate{0};
+
+// Past this, an overshoot is a hiccup rather than how long sleeps take
+static const double maximumSleepEstimateSeconds{0.004};
+
+Uint64 Clock::GetFrequency()
+{
+  static const Uint64 frequency{SDL_GetPerformanceFrequency()};
+
+  return frequency;
+}
+
+void Clock::WaitUntil(Uint64 deadline)
+{
+  static const Uint64 minimumSleepEstimate{FromSeconds(0.001)};
+  static const Uint64 maximumSleepEstimate{FromSeconds(maximumSleepEstimateSeconds)};
+
+  // Start by trusting sleeps to take a scheduler quantum at most
+  if (sleepEstimate == 0)
+    sleepEstimate = FromSeconds(0.002);
+
+  // Forget slow sleeps over time even when there's no room to sleep, or a single hiccup would leave every later wait spinning
+  // A sleep never takes less than the 1 ms asked for
+  sleepEstimate = max(sleepEstimate - sleepEstimate / 64, minimumSleepEstimate);
+
+  auto now = Now();
+
+  // Sleep while there's room for a sleep to overshoot
+  while (now < deadline && deadline - now > sleepEstimate)
+  {
+    SDL_Delay(1);
+
+    auto woken = Now();
+
+    // Follow the slowest recent sleep, but never budget more than a few ms of spinning for it
+    sleepEstimate = min(max(woken - now, sleepEstimate), maximumSleepEstimate);
+
+    now = woken;
+  }
+
+  // Spin the rest
+  while (Now() < deadline)
+    ;
+}
@@ -0,0 +1,35 @@
+#include "FrameTimings.h"
+#include <algorithm>
+
+using namespace std;
+
+FrameTimings::FrameTimings(size_t capacity) : durations(capacity) {}
+
+void FrameTimings::Record(float milliseconds)
+{
+  durations[next] = milliseconds;
+
+  next = (next + 1) % durations.size();
+  count = min(count + 1, durations.size());
+}
+
+FrameTimings::Percentiles FrameTimings::GetPercentiles() const
+{
+  if (count == 0)
+    return Percentiles();
+
+  auto sorted = vector<float>(durations.begin(), durations.begin() + count);
+  sort(sorted.begin(), sorted.end());
+
+  // Nearest rank
+  auto at = [&sorted](float percentile)
+  { return sorted[min(sorted.size() - 1, size_t(percentile * sorted.size()))]; };
+
+  return Percentiles{at(0.5f), at(0.95f), at(0.99f), sorted.back()};
+}
+
+void FrameTimings::Clear()
+{
+  next = 0;
+  count = 0;
+}
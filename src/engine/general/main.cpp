@@ -1,13 +1,24 @@
 #include <iostream>
 #include "Game.h"
+#include "AssetArchive.h"
 
 using namespace std;
 
-int main([[maybe_unused]] int argc, [[maybe_unused]] char **argv)
+int main(int argc, char **argv)
 {
   // Get game instance & run
   try
   {
+    // Build step: pack the assets into an archive, then exit
+    if (argc > 1 && string(argv[1]) == "--pack-assets")
+    {
+      AssetArchive::Pack("./assets", argc > 2 ? argv[2] : AssetArchive::defaultPath);
+      return 0;
+    }
+
+    // Read headless options before the window is created
+    Game::headlessOptions = HeadlessOptions::Parse(argc, argv);
+
     Game &gameInstance = Game::GetInstance();
 
     gameInstance.Start();
@@ -18,5 +29,8 @@ int main([[maybe_unused]] int argc, [[maybe_unused]] char **argv)
     cerr << "=> ERROR: " << error.what() << endl;
   }
 
+  // Tear it down while every other static is still alive
+  Game::Shutdown();
+
   return 0;
 }
\ No newline at end of file
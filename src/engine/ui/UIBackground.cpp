@@ -14,20 +14,12 @@ void UIBackground::Render()
   // Get rect representing this particle
   auto pixelPosition = uiObject.canvas.CanvasToScreen(uiObject.GetPosition());
 
-  SDL_Rect objectBox = SDL_Rect{
-      int(pixelPosition.x),
-      int(pixelPosition.y),
-      uiObject.width.AsRealPixels(),
-      uiObject.height.AsRealPixels()};
-
-  // Get renderer
-  auto renderer = Game::GetInstance().GetRenderer();
-
-  // Use color
-  SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_BLEND);
-
-  SDL_SetRenderDrawColor(renderer, color.red, color.green, color.blue, color.alpha);
-
-  // Fill a rect at this particle's position
-  SDL_RenderFillRect(renderer, &objectBox);
+  SDL_FRect objectBox = SDL_FRect{
+      float(int(pixelPosition.x)),
+      float(int(pixelPosition.y)),
+      float(uiObject.width.AsRealPixels()),
+      float(uiObject.height.AsRealPixels())};
+
+  // Fill a rect at this object's position
+  Game::GetInstance().GetSpriteBatch().Fill(objectBox, color);
 }
@@ -1,4 +1,5 @@
 #include "UIContainer.h"
+#include "Profiler.h"
 
 using namespace std;
 
@@ -84,6 +85,8 @@ auto UIContainer::DestroySelf() -> unordered_map<int, weak_ptr<UIObject>>::itera
 
 void UIContainer::RecalculateChildrenBox()
 {
+  PROFILE_ZONE("UIContainer::RecalculateChildrenBox");
+
   // Perform recalculation
   childrenBox.Recalculate();
 
@@ -90,12 +90,10 @@ void UIControllerSelectable::Awake()
     resetTimer(GetControllerTimer(targetController));
   };
 
-  callbackIdentifier = "controller-selectable-" + to_string(id);
-
   // Set up listeners
-  GetScene()->inputManager.OnControllerLeftAnalog.AddListener(callbackIdentifier, onAnalog);
-  GetScene()->inputManager.OnControllerButtonPress.AddListener(callbackIdentifier, onButton);
-  GetScene()->inputManager.OnControllerButtonRelease.AddListener(callbackIdentifier, onButtonUp);
+  inputSubscriptions.push_back(GetScene()->inputManager.OnControllerLeftAnalog.Subscribe(onAnalog));
+  inputSubscriptions.push_back(GetScene()->inputManager.OnControllerButtonPress.Subscribe(onButton));
+  inputSubscriptions.push_back(GetScene()->inputManager.OnControllerButtonRelease.Subscribe(onButtonUp));
 }
 
 void UIControllerSelectable::MoveControllerSelection(shared_ptr<ControllerDevice> controller, Vector2 targetDirection)
@@ -188,7 +186,7 @@ Timer &UIControllerSelectable::GetControllerTimer(std::shared_ptr<ControllerDevi
   //   };
 
   //   Subscribe to destroy the timer when the controller dies
-  //   controller->OnBeforeDestroy.AddListener("destroy-UIControllerSelectable-timer", destroyTimer);
+  //   controller->OnBeforeDestroy.AddListener(destroyTimer);
   // }
 
   // Return the timer
@@ -197,7 +195,5 @@ Timer &UIControllerSelectable::GetControllerTimer(std::shared_ptr<ControllerDevi
 
 void UIControllerSelectable::OnBeforeDestroy()
 {
-  GetScene()->inputManager.OnControllerLeftAnalog.RemoveListener(callbackIdentifier);
-  GetScene()->inputManager.OnControllerButtonPress.RemoveListener(callbackIdentifier);
-  GetScene()->inputManager.OnControllerButtonRelease.RemoveListener(callbackIdentifier);
+  inputSubscriptions.clear();
 }
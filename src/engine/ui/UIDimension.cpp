@@ -16,10 +16,10 @@ UIDimension4::UIDimension4()
     OnRealPixelSizeChange.Invoke();
   };
 
-  top.OnRealPixelSizeChange.AddListener("directed-dimension", raiseOwn);
-  right.OnRealPixelSizeChange.AddListener("directed-dimension", raiseOwn);
-  bottom.OnRealPixelSizeChange.AddListener("directed-dimension", raiseOwn);
-  left.OnRealPixelSizeChange.AddListener("directed-dimension", raiseOwn);
+  top.OnRealPixelSizeChange.AddListener(raiseOwn);
+  right.OnRealPixelSizeChange.AddListener(raiseOwn);
+  bottom.OnRealPixelSizeChange.AddListener(raiseOwn);
+  left.OnRealPixelSizeChange.AddListener(raiseOwn);
 }
 
 void UIDimension4::Set(UIDimension::UnitType type, float value)
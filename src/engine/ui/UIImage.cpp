@@ -9,36 +9,12 @@ UIImage::UIImage(Canvas &canvas, string name, shared_ptr<UIContainer> parent, st
 void UIImage::SetImagePath(string imagePath)
 {
   this->imagePath = imagePath;
+  image = Resources::GetImage(imagePath);
   ReloadTextureDimensions();
 }
 
 string UIImage::GetImagePath() { return imagePath; }
 
-void UIImage::UseTexture(function<void(SDL_Texture *)> procedure)
-{
-  // Get image texture
-  auto texture = Resources::GetTexture(imagePath);
-
-  // Get color
-  auto modulateColor = style->imageColor.Get();
-
-  // Apply color modulation
-  if (modulateColor != Color::White())
-  {
-    SDL_SetTextureColorMod(texture.get(), modulateColor.red, modulateColor.green, modulateColor.blue);
-
-    if (modulateColor.alpha < 255)
-      SDL_SetTextureAlphaMod(texture.get(), modulateColor.alpha);
-  }
-
-  // Execute procedure
-  procedure(texture.get());
-
-  // Revert modifications to texture
-  SDL_SetTextureColorMod(texture.get(), 255, 255, 255);
-  SDL_SetTextureAlphaMod(texture.get(), 255);
-}
-
 void UIImage::Render()
 {
   if (IsEnabled() == false)
@@ -53,21 +29,10 @@ void UIImage::Render()
   auto pixelPosition = canvas.CanvasToScreen(GetContentPosition()) -
                        Vector2{float(GetUnpaddedWidth()), float(GetUnpaddedHeight())} * (GetScale() - Vector2::One()) / 2;
 
-  SDL_Rect destinationRect = {int(pixelPosition.x), int(pixelPosition.y), int(targetWidth), int(targetHeight)};
-  SDL_Rect sourceRect = {0, 0, textureWidth, textureHeight};
+  SDL_FRect destinationRect = {float(int(pixelPosition.x)), float(int(pixelPosition.y)), float(targetWidth), float(targetHeight)};
 
-  // Puts the texture in the renderer
-  auto render = [&](SDL_Texture *texture)
-  {
-    SDL_RenderCopy(
-        Game::GetInstance().GetRenderer(),
-        texture,
-        &sourceRect,
-        &destinationRect);
-  };
-
-  // Apply render procedure
-  UseTexture(render);
+  // Queue it, with color modulation baked in
+  Game::GetInstance().GetSpriteBatch().Draw(image->texture, image->rect, destinationRect, style->imageColor.Get());
 
   // Debug render
   UIObject::Render();
@@ -75,11 +40,9 @@ void UIImage::Render()
 
 void UIImage::ReloadTextureDimensions()
 {
-  // Get the texture
-  auto texture = Resources::GetTexture(imagePath);
-
-  // Query it's dimensions
-  SDL_QueryTexture(texture.get(), nullptr, nullptr, &textureWidth, &textureHeight);
+  // Get it's dimensions
+  textureWidth = image->rect.w;
+  textureHeight = image->rect.h;
 }
 
 int UIImage::GetContentRealPixelsAlong(UIDimension::Axis axis, UIDimension::Calculation)
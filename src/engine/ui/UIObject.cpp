@@ -16,7 +16,11 @@ UIObject::UIObject(Canvas &canvas, string name, std::shared_ptr<UIContainer> par
       canvas(canvas)
 {
   if (IsCanvasRoot())
+  {
+    // Canvas root's parent is the canvas' own object
+    parentHandle = canvas.gameObject.handle;
     return;
+  }
 
   // Subscribe to own dimension change
   auto alertParent = [this](int, int)
@@ -29,9 +33,9 @@ UIObject::UIObject(Canvas &canvas, string name, std::shared_ptr<UIContainer> par
     parent->forceRecalculation = true;
   };
 
-  width.OnRealPixelSizeChange.AddListener("alert-UIContainer-parent", alertParent);
-  height.OnRealPixelSizeChange.AddListener("alert-UIContainer-parent", alertParent);
-  margin.OnRealPixelSizeChange.AddListener("alert-UIContainer-parent", [alertParent]()
+  width.OnRealPixelSizeChange.AddListener(alertParent);
+  height.OnRealPixelSizeChange.AddListener(alertParent);
+  margin.OnRealPixelSizeChange.AddListener([alertParent]()
                                            { alertParent(0, 0); });
   //  Padding size change is already included in width and height
 
@@ -41,6 +45,7 @@ UIObject::UIObject(Canvas &canvas, string name, std::shared_ptr<UIContainer> par
 
   // Register parent
   weakParent = parent;
+  parentHandle = parent->handle;
 }
 
 UIObject::~UIObject() {}
@@ -113,6 +118,7 @@ void UIObject::SetParent(shared_ptr<UIContainer> newParent, shared_ptr<UIObject>
 
   // Add reference to parent
   weakParent = newParent;
+  parentHandle = newParent != nullptr ? newParent->handle : Handle();
 
   // If not canvas root
   if (IsCanvasRoot() == false)
@@ -171,7 +177,7 @@ void UIObject::RegisterLayer()
 {
   if (GetRenderLayer() != RenderLayer::None)
   {
-    GetScene()->RegisterLayerRenderer(GetScene()->RequireUIObject<Renderable>(id));
+    GetScene()->RegisterLayerRenderer(*this);
   }
 }
 
@@ -252,6 +258,7 @@ auto UIObject::UnlinkParent() -> std::unordered_map<int, std::weak_ptr<UIObject>
   if (iterator != parent->children.end())
     iterator = parent->children.erase(iterator);
   weakParent.reset();
+  parentHandle = Handle();
 
   return iterator;
 }
@@ -432,8 +439,6 @@ bool UIObject::Contains(Vector2 screenPosition)
 
 void UIObject::Awake()
 {
-  callbackIdentifier = "ui-object-" + to_string(id);
-
   if (IsCanvasRoot())
   {
     // Handle mouse click
@@ -447,7 +452,7 @@ void UIObject::Awake()
     };
 
     // Subscribe to mouse click
-    GetScene()->inputManager.OnClickDown.AddListener(callbackIdentifier, handleClick);
+    clickSubscription = GetScene()->inputManager.OnClickDown.Subscribe(handleClick);
   }
 
   GameObject::Awake();
@@ -455,8 +460,7 @@ void UIObject::Awake()
 
 void UIObject::OnBeforeDestroy()
 {
-  if (IsCanvasRoot())
-    GetScene()->inputManager.OnClickDown.RemoveListener(callbackIdentifier);
+  clickSubscription.Cancel();
 
   GameObject::OnBeforeDestroy();
 }
@@ -0,0 +1,360 @@
+#include "AssetArchive.h"
+#include "Helper.h"
+#include <SDL_image.h>
+#include <algorithm>
+#include <climits>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <vector>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+using namespace std;
+using namespace Helper;
+
+const string AssetArchive::defaultPath{"./assets.pak"};
+
+static const char archiveMagic[4]{'B', 'P', 'A', 'K'};
+static const uint32_t archiveVersion{1};
+
+// Asset bytes start at multiples of this, so decoded pixels can be used in place
+static const size_t dataAlignment{16};
+
+// The mapped archive (nullptr if none)
+static const uint8_t *archiveData{nullptr};
+static size_t archiveSize{0};
+
+// Maps the whole file for reading. Returns nullptr on failure
+static const uint8_t *MapFile(const string &path, size_t &size)
+{
+#ifdef _WIN32
+  HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+
+  if (file == INVALID_HANDLE_VALUE)
+    return nullptr;
+
+  LARGE_INTEGER fileSize;
+  HANDLE mapping = nullptr;
+
+  if (GetFileSizeEx(file, &fileSize) && fileSize.QuadPart > 0)
+    mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+
+  // The mapping keeps the file open
+  CloseHandle(file);
+
+  if (mapping == nullptr)
+    return nullptr;
+
+  auto data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+
+  // The view keeps the mapping alive
+  CloseHandle(mapping);
+
+  size = size_t(fileSize.QuadPart);
+
+  return static_cast<const uint8_t *>(data);
+#else
+  int file = open(path.c_str(), O_RDONLY);
+
+  if (file < 0)
+    return nullptr;
+
+  struct stat status;
+  void *data = MAP_FAILED;
+
+  if (fstat(file, &status) == 0 && status.st_size > 0)
+    data = mmap(nullptr, size_t(status.st_size), PROT_READ, MAP_PRIVATE, file, 0);
+
+  // The mapping keeps the file open
+  close(file);
+
+  if (data == MAP_FAILED)
+    return nullptr;
+
+  size = size_t(status.st_size);
+
+  return static_cast<const uint8_t *>(data);
+#endif
+}
+
+static void UnmapFile(const uint8_t *data, size_t size)
+{
+#ifdef _WIN32
+  (void)size;
+  UnmapViewOfFile(data);
+#else
+  munmap(const_cast<uint8_t *>(data), size);
+#endif
+}
+
+bool AssetArchive::IsValid(const uint8_t *data, size_t size)
+{
+  if (size < sizeof(Header))
+    return false;
+
+  auto header = reinterpret_cast<const Header *>(data);
+
+  if (memcmp(header->magic, archiveMagic, sizeof(archiveMagic)) != 0 || header->version != archiveVersion)
+    return false;
+
+  // Divide instead of multiplying, which could overflow
+  if (header->entryCount > (size - sizeof(Header)) / sizeof(Entry))
+    return false;
+
+  // Every entry must lie within the file, so that a truncated or stale archive is rejected instead of read past it's end
+  auto entries = reinterpret_cast<const Entry *>(data + sizeof(Header));
+
+  for (uint32_t index{0}; index < header->entryCount; index++)
+  {
+    auto &entry = entries[index];
+
+    if (entry.nameOffset > size || entry.nameLength > size - entry.nameOffset)
+      return false;
+
+    if (entry.offset > size || entry.size > size - entry.offset)
+      return false;
+
+    // Streams take an int size
+    if (entry.size > uint64_t(INT_MAX))
+      return false;
+
+    if (entry.width == 0)
+      continue;
+
+    // Surfaces take int dimensions & pitch, and the pixels must fit in the entry
+    if (entry.width > uint32_t(INT_MAX / 4) || entry.height > uint32_t(INT_MAX) ||
+        uint64_t(entry.width) * entry.height > entry.size / 4)
+      return false;
+  }
+
+  return true;
+}
+
+bool AssetArchive::Open(string path)
+{
+  Assert(archiveData == nullptr, "Asset archive was already opened");
+
+  size_t size;
+  auto data = MapFile(path, size);
+
+  if (data == nullptr)
+    return false;
+
+  if (IsValid(data, size) == false)
+  {
+    MESSAGE << "WARNING: ignoring invalid asset archive at " << path << endl;
+    UnmapFile(data, size);
+    return false;
+  }
+
+  archiveData = data;
+  archiveSize = size;
+
+  return true;
+}
+
+bool AssetArchive::IsOpen() { return archiveData != nullptr; }
+
+string AssetArchive::Normalize(string filename)
+{
+  replace(filename.begin(), filename.end(), '\\', '/');
+
+  while (filename.compare(0, 2, "./") == 0)
+    filename.erase(0, 2);
+
+  return filename;
+}
+
+// FNV-1a
+uint64_t AssetArchive::Hash(const string &normalizedFilename)
+{
+  uint64_t hash{14695981039346656037ull};
+
+  for (char character : normalizedFilename)
+  {
+    hash ^= uint8_t(character);
+    hash *= 1099511628211ull;
+  }
+
+  return hash;
+}
+
+const AssetArchive::Entry *AssetArchive::Find(string filename)
+{
+  if (archiveData == nullptr)
+    return nullptr;
+
+  filename = Normalize(filename);
+  auto hash = Hash(filename);
+
+  auto header = reinterpret_cast<const Header *>(archiveData);
+  auto entries = reinterpret_cast<const Entry *>(archiveData + sizeof(Header));
+  auto entriesEnd = entries + header->entryCount;
+
+  auto entry = lower_bound(entries, entriesEnd, hash, [](const Entry &entry, uint64_t hash)
+                           { return entry.hash < hash; });
+
+  // Colliding hashes are next to each other
+  for (; entry != entriesEnd && entry->hash == hash; entry++)
+  {
+    auto name = reinterpret_cast<const char *>(archiveData + entry->nameOffset);
+
+    if (entry->nameLength == filename.size() && filename.compare(0, filename.size(), name, entry->nameLength) == 0)
+      return entry;
+  }
+
+  return nullptr;
+}
+
+SDL_RWops *AssetArchive::OpenStream(string filename)
+{
+  auto entry = Find(filename);
+
+  if (entry == nullptr)
+    return SDL_RWFromFile(filename.c_str(), "rb");
+
+  // Decoded pixels are no longer a file
+  if (entry->width > 0)
+    return nullptr;
+
+  return SDL_RWFromConstMem(archiveData + entry->offset, int(entry->size));
+}
+
+SDL_Surface *AssetArchive::LoadSurface(string filename)
+{
+  auto entry = Find(filename);
+
+  if (entry == nullptr || entry->width == 0)
+  {
+    auto stream = OpenStream(filename);
+
+    return stream == nullptr ? nullptr : IMG_Load_RW(stream, 1);
+  }
+
+  // SDL won't write to it, it only needs a non const pointer
+  auto pixels = const_cast<uint8_t *>(archiveData + entry->offset);
+
+  return SDL_CreateRGBSurfaceWithFormatFrom(
+      pixels, int(entry->width), int(entry->height), 32, int(entry->width) * 4, SDL_PIXELFORMAT_RGBA32);
+}
+
+void AssetArchive::Pack(string directory, string path, bool decodeImages)
+{
+  namespace filesystem = std::filesystem;
+
+  struct PackedAsset
+  {
+    string name;
+    Entry entry;
+    vector<uint8_t> bytes;
+  };
+
+  vector<PackedAsset> assets;
+
+  auto isImage = [](string extension)
+  {
+    transform(extension.begin(), extension.end(), extension.begin(), ::tolower);
+
+    return extension == ".png" || extension == ".jpg" || extension == ".jpeg" || extension == ".bmp";
+  };
+
+  for (auto &file : filesystem::recursive_directory_iterator(directory))
+  {
+    if (file.is_regular_file() == false)
+      continue;
+
+    PackedAsset asset{Normalize(file.path().generic_string()), Entry{}, {}};
+
+    if (decodeImages && isImage(file.path().extension().string()))
+    {
+      auto_unique_ptr<SDL_Surface> decoded(IMG_Load(file.path().string().c_str()), SDL_FreeSurface);
+      Assert(decoded != nullptr, "Failed to decode " + asset.name + " for packing", IMG_GetError());
+
+      auto_unique_ptr<SDL_Surface> surface(SDL_ConvertSurfaceFormat(decoded.get(), SDL_PIXELFORMAT_RGBA32, 0), SDL_FreeSurface);
+      Assert(surface != nullptr, "Failed to convert " + asset.name + " for packing");
+
+      // Store rows without padding
+      size_t rowSize = size_t(surface->w) * 4;
+      asset.bytes.resize(rowSize * surface->h);
+
+      for (int row{0}; row < surface->h; row++)
+        memcpy(asset.bytes.data() + row * rowSize, static_cast<uint8_t *>(surface->pixels) + row * surface->pitch, rowSize);
+
+      asset.entry.width = surface->w;
+      asset.entry.height = surface->h;
+    }
+    else
+    {
+      ifstream input(file.path(), ios::binary);
+      asset.bytes.assign(istreambuf_iterator<char>(input), istreambuf_iterator<char>());
+    }
+
+    asset.entry.hash = Hash(asset.name);
+    asset.entry.size = asset.bytes.size();
+
+    assets.push_back(move(asset));
+  }
+
+  sort(assets.begin(), assets.end(), [](const PackedAsset &first, const PackedAsset &second)
+       { return first.entry.hash < second.entry.hash; });
+
+  // Lay it out: header, entries, names, then each asset's bytes
+  size_t position = sizeof(Header) + assets.size() * sizeof(Entry);
+
+  for (auto &asset : assets)
+  {
+    asset.entry.nameOffset = uint32_t(position);
+    asset.entry.nameLength = uint32_t(asset.name.size());
+    position += asset.name.size();
+  }
+
+  auto align = [](size_t position)
+  { return (position + dataAlignment - 1) / dataAlignment * dataAlignment; };
+
+  for (auto &asset : assets)
+  {
+    position = align(position);
+    asset.entry.offset = position;
+    position += asset.bytes.size();
+  }
+
+  // Write it
+  ofstream output(path, ios::binary);
+  Assert(output.is_open(), "Failed to create asset archive at " + path);
+
+  Header header{};
+  memcpy(header.magic, archiveMagic, sizeof(archiveMagic));
+  header.version = archiveVersion;
+  header.entryCount = uint32_t(assets.size());
+
+  output.write(reinterpret_cast<const char *>(&header), sizeof(header));
+
+  for (auto &asset : assets)
+    output.write(reinterpret_cast<const char *>(&asset.entry), sizeof(Entry));
+
+  for (auto &asset : assets)
+    output.write(asset.name.data(), asset.name.size());
+
+  for (auto &asset : assets)
+  {
+    // Pad up to the asset's offset
+    static const char padding[dataAlignment]{};
+    output.write(padding, asset.entry.offset - size_t(output.tellp()));
+
+    output.write(reinterpret_cast<const char *>(asset.bytes.data()), asset.bytes.size());
+  }
+
+  Assert(output.good(), "Failed to write asset archive at " + path);
+
+  MESSAGE << "Packed " << assets.size() << " assets into " << path << " (" << position / 1024 << " KiB)" << endl;
+}
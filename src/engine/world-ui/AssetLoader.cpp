@@ -0,0 +1,216 @@
+#include "AssetLoader.h"
+#include "AssetArchive.h"
+#include "Helper.h"
+#include "Profiler.h"
+#include <algorithm>
+
+using namespace std;
+using namespace Helper;
+
+AssetRequest::AssetRequest(Type type, string filename) : type(type), filename(filename) {}
+
+AssetRequest::~AssetRequest()
+{
+  if (surface != nullptr)
+    SDL_FreeSurface(surface);
+
+  if (chunk != nullptr)
+    Mix_FreeChunk(chunk);
+
+  if (music != nullptr)
+    Mix_FreeMusic(music);
+}
+
+size_t AssetRequest::GetUploadSize() const
+{
+  if (surface == nullptr)
+    return 0;
+
+  return size_t(surface->w) * surface->h * 4;
+}
+
+AssetLoader::AssetLoader(int workerCount)
+{
+  if (workerCount <= 0)
+    return;
+
+  mutex = SDL_CreateMutex();
+  condition = SDL_CreateCond();
+
+  Assert(mutex != nullptr && condition != nullptr, "Failed to create asset loader synchronization");
+
+  for (int worker{0}; worker < workerCount; worker++)
+  {
+    auto thread = SDL_CreateThread(Work, "AssetLoader", this);
+
+    Assert(thread != nullptr, "Failed to create asset loader thread");
+
+    workers.push_back(thread);
+  }
+}
+
+AssetLoader::~AssetLoader()
+{
+  if (workers.empty())
+  {
+    Cancel();
+    return;
+  }
+
+  // Workers finish what they are decoding, then stop
+  SDL_LockMutex(mutex);
+  stopRequested = true;
+  SDL_CondBroadcast(condition);
+  SDL_UnlockMutex(mutex);
+
+  for (auto thread : workers)
+    SDL_WaitThread(thread, nullptr);
+
+  // Free what they decoded, while the libraries are still up
+  Cancel();
+
+  SDL_DestroyCond(condition);
+  SDL_DestroyMutex(mutex);
+}
+
+int AssetLoader::GetDefaultWorkerCount() { return clamp(SDL_GetCPUCount() - 2, 1, 4); }
+
+void AssetLoader::Enqueue(shared_ptr<AssetRequest> request)
+{
+  if (workers.empty())
+  {
+    Decode(*request);
+    decoded.push_back(request);
+    return;
+  }
+
+  SDL_LockMutex(mutex);
+  queued.push_back(request);
+  SDL_CondSignal(condition);
+  SDL_UnlockMutex(mutex);
+}
+
+shared_ptr<AssetRequest> AssetLoader::TakeDecoded()
+{
+  shared_ptr<AssetRequest> request;
+
+  if (mutex != nullptr)
+    SDL_LockMutex(mutex);
+
+  if (decoded.empty() == false)
+  {
+    request = decoded.front();
+    decoded.pop_front();
+  }
+
+  if (mutex != nullptr)
+    SDL_UnlockMutex(mutex);
+
+  return request;
+}
+
+void AssetLoader::Wait(const shared_ptr<AssetRequest> &request)
+{
+  if (workers.empty())
+    return;
+
+  SDL_LockMutex(mutex);
+
+  // If it's still queued, don't wait for a worker
+  auto queuedIterator = find(queued.begin(), queued.end(), request);
+
+  if (queuedIterator != queued.end())
+  {
+    queued.erase(queuedIterator);
+    SDL_UnlockMutex(mutex);
+
+    Decode(*request);
+    return;
+  }
+
+  while (request->state == AssetRequest::State::Decoding)
+    SDL_CondWait(condition, mutex);
+
+  SDL_UnlockMutex(mutex);
+}
+
+void AssetLoader::Cancel()
+{
+  if (mutex != nullptr)
+    SDL_LockMutex(mutex);
+
+  queued.clear();
+  decoded.clear();
+
+  if (mutex != nullptr)
+    SDL_UnlockMutex(mutex);
+}
+
+int AssetLoader::Work(void *loaderPointer)
+{
+  auto &loader = *static_cast<AssetLoader *>(loaderPointer);
+
+#ifdef PROFILE_FRAMES
+  Profiler::SetThreadName("Asset loader");
+#endif
+
+  SDL_LockMutex(loader.mutex);
+
+  while (true)
+  {
+    while (loader.queued.empty() && loader.stopRequested == false)
+      SDL_CondWait(loader.condition, loader.mutex);
+
+    if (loader.stopRequested)
+      break;
+
+    auto request = loader.queued.front();
+    loader.queued.pop_front();
+
+    request->state = AssetRequest::State::Decoding;
+
+    // Decode without holding the lock
+    SDL_UnlockMutex(loader.mutex);
+    Decode(*request);
+    SDL_LockMutex(loader.mutex);
+
+    loader.decoded.push_back(request);
+
+    // Wake anyone waiting on this request
+    SDL_CondBroadcast(loader.condition);
+  }
+
+  SDL_UnlockMutex(loader.mutex);
+
+  return 0;
+}
+
+void AssetLoader::Decode(AssetRequest &request)
+{
+  PROFILE_ZONE("AssetLoader::Decode");
+
+  request.state = AssetRequest::State::Decoding;
+
+  auto &filename = request.filename;
+  bool decoded{false};
+
+  switch (request.type)
+  {
+  case AssetRequest::Type::Image:
+    request.surface = AssetArchive::LoadSurface(filename);
+    decoded = request.surface != nullptr;
+    break;
+
+  case AssetRequest::Type::Sound:
+    request.chunk = Mix_LoadWAV_RW(AssetArchive::OpenStream(filename), 1);
+    decoded = request.chunk != nullptr;
+    break;
+
+  case AssetRequest::Type::Music:
+    request.music = Mix_LoadMUS_RW(AssetArchive::OpenStream(filename), 1);
+    decoded = request.music != nullptr;
+    break;
+  }
+
+  request.state = decoded ? AssetRequest::State::Decoded : AssetRequest::State::Failed;
+}
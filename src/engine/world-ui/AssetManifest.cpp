@@ -0,0 +1,110 @@
+#include "AssetManifest.h"
+#include <fstream>
+#include <sstream>
+#include <tuple>
+
+using namespace std;
+
+bool AssetManifest::SpriteClip::operator<(const SpriteClip &other) const
+{
+  return tie(filename, clip.x, clip.y, clip.w, clip.h) <
+         tie(other.filename, other.clip.x, other.clip.y, other.clip.w, other.clip.h);
+}
+
+void AssetManifest::Merge(const AssetManifest &other)
+{
+  images.insert(other.images.begin(), other.images.end());
+  sounds.insert(other.sounds.begin(), other.sounds.end());
+  music.insert(other.music.begin(), other.music.end());
+  fonts.insert(other.fonts.begin(), other.fonts.end());
+  sprites.insert(other.sprites.begin(), other.sprites.end());
+}
+
+size_t AssetManifest::Count() const
+{
+  return images.size() + sounds.size() + music.size() + fonts.size() + sprites.size();
+}
+
+void AssetManifest::Clear()
+{
+  images.clear();
+  sounds.clear();
+  music.clear();
+  fonts.clear();
+  sprites.clear();
+}
+
+// Each line is the asset type, it's parameters, then it's filename (which takes the rest of the line, as it may have spaces)
+AssetManifest AssetManifest::Load(string path)
+{
+  AssetManifest manifest;
+
+  ifstream file(path);
+  string line;
+
+  while (getline(file, line))
+  {
+    istringstream stream(line);
+    string type;
+
+    stream >> type;
+
+    auto readFilename = [&stream]()
+    {
+      string filename;
+      getline(stream >> ws, filename);
+      return filename;
+    };
+
+    if (type == "image")
+      manifest.images.insert(readFilename());
+
+    else if (type == "sound")
+      manifest.sounds.insert(readFilename());
+
+    else if (type == "music")
+      manifest.music.insert(readFilename());
+
+    else if (type == "font")
+    {
+      int size;
+      stream >> size;
+      manifest.fonts.emplace(readFilename(), size);
+    }
+
+    else if (type == "sprite")
+    {
+      SDL_Rect clip;
+      stream >> clip.x >> clip.y >> clip.w >> clip.h;
+      manifest.sprites.insert(SpriteClip{readFilename(), clip});
+    }
+  }
+
+  return manifest;
+}
+
+bool AssetManifest::Save(string path) const
+{
+  ofstream file(path);
+
+  if (file.is_open() == false)
+    return false;
+
+  for (auto &filename : images)
+    file << "image " << filename << "\n";
+
+  for (auto &filename : sounds)
+    file << "sound " << filename << "\n";
+
+  for (auto &filename : music)
+    file << "music " << filename << "\n";
+
+  for (auto &[filename, size] : fonts)
+    file << "font " << size << " " << filename << "\n";
+
+  for (auto &sprite : sprites)
+    file << "sprite " << sprite.clip.x << " " << sprite.clip.y << " " << sprite.clip.w << " " << sprite.clip.h << " "
+         << sprite.filename << "\n";
+
+  return file.good();
+}
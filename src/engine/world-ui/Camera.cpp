@@ -14,6 +14,7 @@ static const float screenRatio = float(Game::screenWidth) / float(Game::screenHe
 
 const Color Camera::defaultBackground{0, 30, 137};
 const float Camera::initialSize{5};
+const float Camera::cullingMargin{1};
 
 static const Vector2 screenQuarter = Vector2(-Game::screenWidth / 2.0f, -Game::screenHeight / 2.0f);
 
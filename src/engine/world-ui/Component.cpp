@@ -1,15 +1,19 @@
 #include "GameObject.h"
 #include "WorldComponent.h"
 #include "Game.h"
+#include "ComponentProfiler.h"
 
 using namespace std;
 
+HandleTable<Component> Component::handleTable;
+
 Component::Component(GameObject &associatedObject)
     : gameObject(associatedObject),
       id(GetScene()->SupplyId()),
+      handle(handleTable.Insert(this)),
       inputManager(Game::GetInstance().GetInputManager()) {}
 
-Component::~Component() {}
+Component::~Component() { handleTable.Remove(handle); }
 
 void Component::SetEnabled(bool value) { enabled = value; }
 
@@ -27,7 +31,7 @@ void Component::RegisterLayer()
 {
   if (GetRenderLayer() != RenderLayer::None)
   {
-    Game::GetInstance().GetScene()->RegisterLayerRenderer(gameObject.RequireComponent(this));
+    Game::GetInstance().GetScene()->RegisterLayerRenderer(*this);
   }
 }
 
@@ -38,6 +42,7 @@ void Component::SafeStart()
 
   started = true;
 
+  PROFILE_COMPONENT(*this, Start);
   Start();
 }
 
@@ -0,0 +1,163 @@
+#include "ComponentProfiler.h"
+#include "Helper.h"
+#include <algorithm>
+#include <fstream>
+#include <iomanip>
+
+#ifdef __GNUG__
+#include <cstdlib>
+#include <cxxabi.h>
+#endif
+
+using namespace std;
+using namespace Helper;
+
+unordered_map<type_index, ComponentProfiler::TypeStats> ComponentProfiler::stats;
+
+ComponentTimer *ComponentTimer::current{nullptr};
+
+ComponentTimer::~ComponentTimer()
+{
+  auto totalTicks = Clock::Now() - start;
+
+  current = parent;
+
+  if (parent != nullptr)
+    parent->childTicks += totalTicks;
+
+  ComponentProfiler::Record(type, phase, totalTicks, totalTicks - childTicks);
+}
+
+Uint64 ComponentProfiler::TypeStats::GetSelfTicks() const
+{
+  Uint64 ticks{0};
+
+  for (auto &phase : phases)
+    ticks += phase.selfTicks;
+
+  return ticks;
+}
+
+void ComponentProfiler::Record(const type_info &type, Phase phase, Uint64 totalTicks, Uint64 selfTicks)
+{
+  auto &typeStats = stats[type_index(type)];
+
+  if (typeStats.typeName.empty())
+    typeStats.typeName = GetTypeName(type);
+
+  auto &phaseStats = typeStats.phases[size_t(phase)];
+
+  phaseStats.calls++;
+  phaseStats.totalTicks += totalTicks;
+  phaseStats.selfTicks += selfTicks;
+}
+
+vector<ComponentProfiler::TypeStats> ComponentProfiler::GetStats()
+{
+  vector<TypeStats> sortedStats;
+  sortedStats.reserve(stats.size());
+
+  for (auto &[type, typeStats] : stats)
+    sortedStats.push_back(typeStats);
+
+  sort(sortedStats.begin(), sortedStats.end(), [](const TypeStats &first, const TypeStats &second)
+       { return first.GetSelfTicks() > second.GetSelfTicks(); });
+
+  return sortedStats;
+}
+
+void ComponentProfiler::Reset() { stats.clear(); }
+
+void ComponentProfiler::PrintTable(ostream &stream)
+{
+  auto sortedStats = GetStats();
+
+  stream << left << setw(32) << "Type";
+
+  for (size_t phase{0}; phase < phaseCount; phase++)
+    stream << right << setw(24) << GetPhaseName(Phase(phase));
+
+  stream << right << setw(12) << "Self ms" << endl;
+
+  // Each phase shows calls and self time
+  stream << fixed << setprecision(2);
+
+  for (auto &typeStats : sortedStats)
+  {
+    stream << left << setw(32) << typeStats.typeName.substr(0, 31);
+
+    for (auto &phaseStats : typeStats.phases)
+      stream << right << setw(12) << phaseStats.calls << setw(12) << Clock::ToMilliseconds(phaseStats.selfTicks);
+
+    stream << right << setw(12) << Clock::ToMilliseconds(typeStats.GetSelfTicks()) << endl;
+  }
+
+  stream << defaultfloat << setprecision(6);
+}
+
+bool ComponentProfiler::ExportCsv(string path)
+{
+  ofstream output(path);
+
+  if (output.is_open() == false)
+  {
+    MESSAGE << "WARNING: Failed to open component profile at " << path << endl;
+    return false;
+  }
+
+  output << "type,phase,calls,total_ms,self_ms" << endl;
+  output << fixed << setprecision(4);
+
+  for (auto &typeStats : GetStats())
+    for (size_t phase{0}; phase < phaseCount; phase++)
+    {
+      auto &phaseStats = typeStats.phases[phase];
+
+      if (phaseStats.calls == 0)
+        continue;
+
+      // Template names may hold commas
+      output << "\"" << typeStats.typeName << "\"," << GetPhaseName(Phase(phase)) << "," << phaseStats.calls << ","
+             << Clock::ToMilliseconds(phaseStats.totalTicks) << "," << Clock::ToMilliseconds(phaseStats.selfTicks) << endl;
+    }
+
+  return output.good();
+}
+
+const char *ComponentProfiler::GetPhaseName(Phase phase)
+{
+  switch (phase)
+  {
+  case Phase::Start:
+    return "Start";
+  case Phase::Update:
+    return "Update";
+  case Phase::PhysicsUpdate:
+    return "PhysicsUpdate";
+  case Phase::Render:
+    return "Render";
+  case Phase::Collision:
+    return "Collision";
+  }
+
+  return "Unknown";
+}
+
+string ComponentProfiler::GetTypeName(const type_info &type)
+{
+#ifdef __GNUG__
+  // GCC names types by their mangled names
+  int status;
+  char *demangled = abi::__cxa_demangle(type.name(), nullptr, nullptr, &status);
+
+  if (status == 0)
+  {
+    string name{demangled};
+    free(demangled);
+
+    return name;
+  }
+#endif
+
+  return type.name();
+}
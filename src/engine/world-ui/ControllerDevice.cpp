@@ -105,8 +105,8 @@ void ControllerDevice::SearchPlayersForAssociation()
 
 void ControllerDevice::RegisterPlayerManager(std::shared_ptr<PlayerManager> playerManager)
 {
-  playerManager->OnPlayerSearchForController.AddListener("add-controller", [this](shared_ptr<Player> player)
-                                                         { MaybeAssociateToPlayer(player); });
+  playerManagerSubscription = playerManager->OnPlayerSearchForController.Subscribe([this](shared_ptr<Player> player)
+                                                                                  { MaybeAssociateToPlayer(player); });
 }
 
 bool ControllerDevice::SearchingForPlayer() const { return weakAssociationPlayer.expired(); }
@@ -2,27 +2,61 @@
 #include "Game.h"
 #include "Camera.h"
 #include <SDL.h>
+#include <vector>
 
-void Debug::DrawPoint(Vector2 point, Color color)
+using namespace std;
+
+// Drawings queued with the same color
+struct ColorQueue
 {
-  point = Camera::GetMain()->WorldToScreen(point);
+  Color color;
 
-  auto renderer = Game::GetInstance().GetRenderer();
+  // Points, in world coordinates
+  vector<Vector2> points;
 
-  SDL_SetRenderDrawColor(renderer, color.red, color.green, color.blue, color.alpha);
+  vector<Circle> circles;
 
-  SDL_RenderDrawPoint(renderer, point.x, point.y);
-}
+  // Vertices of connected lines, in world coordinates
+  vector<Vector2> stripVertices;
 
-// Got this from the internet
-void Debug::DrawCircle(Circle circle, Color color)
+  // How many vertices each connected line has
+  vector<int> stripLengths;
+};
+
+// Queues of each color used this frame
+// Only a handful of colors are ever used, so they are searched linearly
+static vector<ColorQueue> queues;
+
+// How many queues are in use, so their buffers are kept between frames
+static size_t queuesInUse{0};
+
+static ColorQueue &GetQueue(Color color)
 {
-  auto renderer = Game::GetInstance().GetRenderer();
+  for (size_t index{0}; index < queuesInUse; index++)
+    if (queues[index].color == color)
+      return queues[index];
 
-  auto radius = Camera::GetMain()->GetRealPixelsPerUnit() * circle.radius;
+  if (queuesInUse == queues.size())
+    queues.emplace_back();
 
-  auto center = Camera::GetMain()->WorldToScreen(circle.center);
+  auto &queue = queues[queuesInUse++];
+  queue.color = color;
 
+  return queue;
+}
+
+// Queues a line connecting each vertex to the next
+static void QueueStrip(Color color, initializer_list<Vector2> vertices)
+{
+  auto &queue = GetQueue(color);
+
+  queue.stripVertices.insert(queue.stripVertices.end(), vertices);
+  queue.stripLengths.push_back(int(vertices.size()));
+}
+
+// Got this from the internet
+static void RasterizeCircle(Vector2 center, float radius, vector<SDL_FPoint> &points)
+{
   int32_t centreX = center.x;
   int32_t centreY = center.y;
 
@@ -34,19 +68,20 @@ void Debug::DrawCircle(Circle circle, Color color)
   int32_t ty = 1;
   int32_t error = (tx - diameter);
 
-  SDL_SetRenderDrawColor(renderer, color.red, color.green, color.blue, color.alpha);
+  auto addPoint = [&points](int32_t x, int32_t y)
+  { points.push_back(SDL_FPoint{float(x), float(y)}); };
 
   while (x >= y)
   {
     //  Each of the following renders an octant of the circle
-    SDL_RenderDrawPoint(renderer, centreX + x, centreY - y);
-    SDL_RenderDrawPoint(renderer, centreX + x, centreY + y);
-    SDL_RenderDrawPoint(renderer, centreX - x, centreY - y);
-    SDL_RenderDrawPoint(renderer, centreX - x, centreY + y);
-    SDL_RenderDrawPoint(renderer, centreX + y, centreY - x);
-    SDL_RenderDrawPoint(renderer, centreX + y, centreY + x);
-    SDL_RenderDrawPoint(renderer, centreX - y, centreY - x);
-    SDL_RenderDrawPoint(renderer, centreX - y, centreY + x);
+    addPoint(centreX + x, centreY - y);
+    addPoint(centreX + x, centreY + y);
+    addPoint(centreX - x, centreY - y);
+    addPoint(centreX - x, centreY + y);
+    addPoint(centreX + y, centreY - x);
+    addPoint(centreX + y, centreY + x);
+    addPoint(centreX - y, centreY - x);
+    addPoint(centreX - y, centreY + x);
 
     if (error <= 0)
     {
@@ -64,51 +99,81 @@ void Debug::DrawCircle(Circle circle, Color color)
   }
 }
 
-void Debug::DrawBox(Rectangle box, Color color)
-{
-  auto camera = Camera::GetMain();
+void Debug::DrawPoint(Vector2 point, Color color) { GetQueue(color).points.push_back(point); }
 
-  // Create an SDL point for each vertex
-  SDL_Point vertices[5];
+void Debug::DrawCircle(Circle circle, Color color) { GetQueue(color).circles.push_back(circle); }
 
+void Debug::DrawBox(Rectangle box, Color color)
+{
   // Starting and final points are top left
-  vertices[0] = (SDL_Point)camera->WorldToScreen(box.TopLeft());
-  vertices[1] = (SDL_Point)camera->WorldToScreen(box.BottomLeft());
-  vertices[2] = (SDL_Point)camera->WorldToScreen(box.BottomRight());
-  vertices[3] = (SDL_Point)camera->WorldToScreen(box.TopRight());
-  vertices[4] = (SDL_Point)camera->WorldToScreen(box.TopLeft());
+  QueueStrip(color, {box.TopLeft(), box.BottomLeft(), box.BottomRight(), box.TopRight(), box.TopLeft()});
+}
 
-  // Get renderer
-  auto renderer = Game::GetInstance().GetRenderer();
+void Debug::DrawLine(Vector2 start, Vector2 end, Color color) { QueueStrip(color, {start, end}); }
 
-  // Set paint color to green
-  SDL_SetRenderDrawColor(renderer, color.red, color.green, color.blue, color.alpha);
+void Debug::DrawArrow(Vector2 start, Vector2 end, Color color, float headSize, float headArcAngle)
+{
+  // Get vector of head size
+  auto headVector = (start - end).Normalized() * headSize;
 
-  // Paint collider edges
-  SDL_RenderDrawLines(renderer, vertices, 5);
+  // Line, then both head sides
+  QueueStrip(color, {start, end, end + headVector.Rotated(headArcAngle / 2)});
+  QueueStrip(color, {end, end + headVector.Rotated(-headArcAngle / 2)});
 }
 
-void Debug::DrawLine(Vector2 start, Vector2 end, Color color)
+void Debug::Flush()
 {
-  start = Camera::GetMain()->WorldToScreen(start);
-  end = Camera::GetMain()->WorldToScreen(end);
+  if (queuesInUse == 0)
+    return;
 
-  auto renderer = Game::GetInstance().GetRenderer();
+  // Draw on top of queued quads
+  Game::GetInstance().GetSpriteBatch().Flush();
 
-  SDL_SetRenderDrawColor(renderer, color.red, color.green, color.blue, color.alpha);
+  auto &commandList = Game::GetInstance().GetRenderThread().GetRecordingList();
 
-  SDL_RenderDrawLineF(renderer, start.x, start.y, end.x, end.y);
-}
+  // Get the camera only once for all conversions
+  auto camera = Camera::GetMain();
+  float pixelsPerUnit = camera->GetRealPixelsPerUnit();
 
-void Debug::DrawArrow(Vector2 start, Vector2 end, Color color, float headSize, float headArcAngle)
-{
-  // First draw arrow line
-  DrawLine(start, end, color);
+  auto toScreen = [&camera](Vector2 point)
+  {
+    point = camera->WorldToScreen(point);
+    return SDL_FPoint{float(int(point.x)), float(int(point.y))};
+  };
 
-  // Get vector of head size
-  auto headVector = (start - end).Normalized() * headSize;
+  static vector<SDL_FPoint> screenPoints;
+
+  for (size_t index{0}; index < queuesInUse; index++)
+  {
+    auto &queue = queues[index];
+
+    // Points & circles
+    screenPoints.clear();
+
+    for (auto point : queue.points)
+      screenPoints.push_back(toScreen(point));
+
+    for (auto &circle : queue.circles)
+      RasterizeCircle(camera->WorldToScreen(circle.center), circle.radius * pixelsPerUnit, screenPoints);
+
+    if (screenPoints.empty() == false)
+      commandList.Points(queue.color, screenPoints);
+
+    // Lines
+    screenPoints.clear();
+
+    for (auto vertex : queue.stripVertices)
+      screenPoints.push_back(toScreen(vertex));
+
+    if (screenPoints.empty() == false)
+      commandList.LineStrips(queue.color, screenPoints, queue.stripLengths);
+
+    // Empty the queue, keeping it's buffers
+    queue.points.clear();
+    queue.circles.clear();
+    queue.stripVertices.clear();
+    queue.stripLengths.clear();
+  }
 
-  // Draw head sides
-  DrawLine(end, end + headVector.Rotated(headArcAngle / 2), color);
-  DrawLine(end, end + headVector.Rotated(-headArcAngle / 2), color);
+  queuesInUse = 0;
 }
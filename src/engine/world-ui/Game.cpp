@@ -6,11 +6,16 @@
 #include <SDL_gamecontroller.h>
 #include <cstdlib>
 #include <ctime>
+#include <cstdio>
 #include "Game.h"
 #include "Helper.h"
 #include "Resources.h"
 #include "GameScene.h"
 #include "ArenaScene.h"
+#include "Debug.h"
+#include "AssetArchive.h"
+#include "VoiceManager.h"
+#include "Profiler.h"
 
 using namespace std;
 using namespace Helper;
@@ -24,17 +29,47 @@ static int framesThisSecond{0};
 // How many physics frames have been processed in the last second
 static int physicsFramesThisSecond{0};
 
-// Counter (in ms) for counting how many frames are being rendered per second
-static int secondCounter{0};
+// Counter (in clock ticks) for counting how many frames are being rendered per second
+static Uint64 secondCounter{0};
+#endif
+
+// Longest time a single frame may simulate, in seconds
+// Longer stalls (such as the window being dragged, which blocks event polling) are simulated as if they were this long
+static const float maximumDeltaTime{0.1f};
+
+// Gives when something which was due at the given time should happen next
+// Deadlines advance by whole intervals so they don't drift. When running late, whole intervals are skipped instead of rushing to catch up
+static Uint64 Reschedule(Uint64 dueAt, Uint64 interval)
+{
+  auto now = Clock::Now();
+  auto next = dueAt + interval;
+
+  if (next <= now)
+    next += ((now - next) / interval + 1) * interval;
+
+  return next;
+}
+
+#ifdef PRINT_STARTUP_TIME
+// When the game instance started being created
+static Uint64 startupCounter{0};
 #endif
 
 // === EXTERNAL METHODS =================================
 
 // Initializes SDL
-auto InitializeSDL(string title, int width, int height) -> pair<SDL_Window *, SDL_Renderer *>
+// When given an offscreen surface, no window is created and the renderer draws onto the surface instead
+auto InitializeSDL(string title, int width, int height, SDL_Surface *offscreenSurface) -> pair<SDL_Window *, SDL_Renderer *>
 {
   // === BASE SDL
 
+  // Without a window there's no need for real video or audio devices
+  if (offscreenSurface != nullptr)
+  {
+    SDL_setenv("SDL_VIDEODRIVER", "dummy", 1);
+    SDL_setenv("SDL_AUDIODRIVER", "dummy", 1);
+  }
+
   // Initialize SDL & all it's necessary subsystems
   auto encounteredError = SDL_Init(SDL_INIT_VIDEO | SDL_INIT_AUDIO | SDL_INIT_TIMER | SDL_INIT_GAMECONTROLLER);
 
@@ -62,14 +97,28 @@ auto InitializeSDL(string title, int width, int height) -> pair<SDL_Window *, SD
   // Catch any errors
   Assert(!encounteredError, "Failed to initialize SDL-mixer", Mix_GetError());
 
-  // Allocate more sound channels
-  Mix_AllocateChannels(32);
-
   // === SDL FONTS
 
   // Ensure initializing works
   Assert(TTF_Init() == 0, "Failed to initialize SDL-ttf", TTF_GetError());
 
+  // === CONTROLLERS
+
+  // Enable controller events
+  SDL_GameControllerEventState(SDL_ENABLE);
+
+  // === OFFSCREEN RENDERER
+
+  if (offscreenSurface != nullptr)
+  {
+    auto renderer = SDL_CreateSoftwareRenderer(offscreenSurface);
+
+    // Catch any errors
+    Assert(renderer != nullptr, "Failed to create SDL software renderer");
+
+    return make_pair(nullptr, renderer);
+  }
+
   // === GAME WINDOW
 
   auto gameWindow = SDL_CreateWindow(
@@ -79,16 +128,15 @@ auto InitializeSDL(string title, int width, int height) -> pair<SDL_Window *, SD
   Assert(gameWindow != nullptr, "Failed to create SDL window");
 
   // Create renderer
+#ifdef VSYNC_PACING
+  auto renderer = SDL_CreateRenderer(gameWindow, -1, SDL_RENDERER_ACCELERATED | SDL_RENDERER_PRESENTVSYNC);
+#else
   auto renderer = SDL_CreateRenderer(gameWindow, -1, SDL_RENDERER_ACCELERATED);
+#endif
 
   // Catch any errors
   Assert(renderer != nullptr, "Failed to create SDL renderer");
 
-  // === CONTROLLERS
-
-  // Enable controller events
-  SDL_GameControllerEventState(SDL_ENABLE);
-
   return make_pair(gameWindow, renderer);
 }
 
@@ -96,7 +144,8 @@ void ExitSDL(SDL_Window *window, SDL_Renderer *renderer)
 {
   SDL_DestroyRenderer(renderer);
 
-  SDL_DestroyWindow(window);
+  if (window != nullptr)
+    SDL_DestroyWindow(window);
 
   TTF_Quit();
 
@@ -117,14 +166,22 @@ unique_ptr<Game> Game::gameInstance = nullptr;
 // Path to engine's default font
 const string Game::defaultFontPath{"assets/engine/fonts/PixelOperator.ttf"};
 
+HeadlessOptions Game::headlessOptions;
+
 unsigned long Game::currentFrame{0};
 unsigned long Game::currentPhysicsFrame{0};
 
 // === PRIVATE METHODS =======================================
 
 Game::Game(string title, int width, int height)
-    : window(nullptr, SDL_DestroyWindow), renderer(nullptr, SDL_DestroyRenderer)
+    : window(nullptr, SDL_DestroyWindow),
+      renderer(nullptr, SDL_DestroyRenderer),
+      offscreenSurface(nullptr, SDL_FreeSurface)
 {
+#ifdef PRINT_STARTUP_TIME
+  startupCounter = Clock::Now();
+#endif
+
   // === SINGLETON CHECK
 
   // Check for invalid existing instance
@@ -133,47 +190,96 @@ Game::Game(string title, int width, int height)
 
   // === INIT SDL
 
+  // In headless mode, render to a surface instead of a window
+  if (headlessOptions.enabled)
+  {
+    offscreenSurface.reset(SDL_CreateRGBSurfaceWithFormat(0, width, height, 32, SDL_PIXELFORMAT_ARGB8888));
+
+    Assert(offscreenSurface != nullptr, "Failed to create offscreen surface");
+  }
+
   // Retrieve the window & the renderer from the initializer
-  auto pointers = InitializeSDL(title, width, height);
+  auto pointers = InitializeSDL(title, width, height, offscreenSurface.get());
 
   // === INITIALIZE SCENE
 
   window.reset(pointers.first);
   renderer.reset(pointers.second);
 
+#ifdef PROFILE_FRAMES
+  Profiler::SetThreadName("Main");
+#endif
+
+  // === INIT RENDER THREAD
+
+#ifdef RENDER_THREAD
+  // Headless captures need each frame presented as soon as it's submitted
+  bool threadedRendering = headlessOptions.enabled == false;
+#else
+  bool threadedRendering = false;
+#endif
+
+  renderThread = make_unique<RenderThread>(renderer.get(), renderContext, threadedRendering);
+
+  // === INIT AUDIO
+
+  voiceManager = make_unique<VoiceManager>(32);
+
+  // === INIT ASSETS
+
+  // Read assets from the archive if one was packed, unless loose files are requested
+  const char *looseAssetsFlag = getenv("BOTECO_LOOSE_ASSETS");
+
+  if (looseAssetsFlag == nullptr || string(looseAssetsFlag) == "" || string(looseAssetsFlag) == "0")
+    AssetArchive::Open();
+
+  // Headless runs decode on the main thread, so assets are packed in the same order every run
+  assetLoader = make_unique<AssetLoader>(headlessOptions.enabled ? 0 : AssetLoader::GetDefaultWorkerCount());
+
   // === INIT RANDOMNESS
 
-  srand(time(NULL));
+  // Headless runs must be reproducible
+  srand(headlessOptions.enabled ? 0 : time(NULL));
 }
 
 Game::~Game()
 {
+  // Stop rendering before the renderer goes away
+  renderThread.reset();
+
+  // Stop decoding & free whatever was decoded but not stored before the libraries go away
+  assetLoader.reset();
+  Resources::CancelLoads();
+
+  // Free samples before the mixer goes away. The bank is still alive, as the game is shut down before main returns
+  voiceManager->StopAll();
+  SoundBank::Release();
+
   // Quit SDL
   // Release the pointers, as we will destroy them in the method
   ExitSDL(window.release(), renderer.release());
 }
 
-void Game::CalculateDeltaTime(int &start, float &deltaTime)
+void Game::CalculateDeltaTime(Uint64 &start, float &deltaTime)
 {
   // Get this frame's start time
-  int newStart = SDL_GetTicks();
+  Uint64 newStart = GetTime();
 
-  // Calculate & convert delta time from ms to s
-  deltaTime = (float)(newStart - start) / 1000.0f;
+  Assert(newStart >= start, "Delta time calculation failed: got a negative number");
 
-  // Apply discount
-  Assert(deltaTime >= 0, "Delta time calculation failed: got a negative number");
+  // Calculate & convert delta time from ticks to s
+  deltaTime = min(float(Clock::ToSeconds(newStart - start)), maximumDeltaTime);
 
   // Update frame start variable
   start = newStart;
 }
 
 #ifdef DISPLAY_REAL_FPS
-void Game::CountElapsedFrames(int elapsedMilliseconds)
+void Game::CountElapsedFrames(Uint64 elapsedTicks)
 {
-  secondCounter += elapsedMilliseconds;
+  secondCounter += elapsedTicks;
 
-  if (secondCounter >= 1000)
+  if (secondCounter >= Clock::GetFrequency())
   {
     // Reset counter
     secondCounter = 0;
@@ -182,54 +288,44 @@ void Game::CountElapsedFrames(int elapsedMilliseconds)
     physicsFramesInLastSecond = physicsFramesThisSecond;
     framesThisSecond = 0;
     physicsFramesThisSecond = 0;
+
+    // Frame pacing, from the median & 99th percentile frame intervals
+    // Sorting the timings is only worth it when the text changes
+    auto timings = frameTimings.GetPercentiles();
+    char pacing[32];
+    snprintf(pacing, sizeof(pacing), " (%.1f, p99 %.1f ms)", timings.p50, timings.p99);
+
+    realFpsText = to_string(framesInLastSecond) + "fps" + pacing + ", " + to_string(physicsFramesInLastSecond) + "pfps";
   }
 }
 
 void Game::DisplayRealFps()
 {
   // Get text
-  string text = to_string(framesInLastSecond) + "fps, " + to_string(physicsFramesInLastSecond) + "pfps";
+  string text = realFpsText;
 
-  // Get font
-  auto font = Resources::GetFont(defaultFontPath, 25);
+  // Get glyphs
+  auto glyphAtlas = Resources::GetGlyphAtlas(defaultFontPath, 25);
 
-  // Get texture
-
-  // Will hold the generated surface
-  static auto_unique_ptr<SDL_Surface> surface(nullptr, SDL_FreeSurface);
+  // Get position
+  static const int padding{10};
+  static const Vector2 rawPosition{float(screenWidth) - padding, padding};
+  // Offset coordinates to right align text
+  Vector2 position = rawPosition - Vector2{float(glyphAtlas->MeasureWidth(text)), 0};
 
-  // Use the appropriate method to load this
-  surface.reset(TTF_RenderText_Solid(font.get(), text.c_str(), Color::Yellow()));
+  // Queue it
+  glyphAtlas->Draw(text, position, Color::Yellow());
 
-  // Ensure it's loaded
-  Assert(surface != nullptr, "Failed to generate surface for frame counter font");
+  // Audio voices & the memory their samples take go below it
+  auto voiceStats = voiceManager->GetStats();
 
-  // Convert to texture
-  static auto_unique_ptr<SDL_Texture> texture(nullptr, SDL_DestroyTexture);
+  text = to_string(voiceStats.activeVoices) + "/" + to_string(voiceStats.channelCount) + " voices, " +
+         to_string(voiceStats.stolen) + " stolen, " + to_string(voiceStats.culled + voiceStats.dropped) + " skipped, " +
+         to_string(SoundBank::GetResidentBytes() / 1024) + " KiB";
 
-  texture.reset(SDL_CreateTextureFromSurface(GetRenderer(), surface.get()));
+  position = rawPosition + Vector2{-float(glyphAtlas->MeasureWidth(text)), float(glyphAtlas->MeasureHeight())};
 
-  // Get position
-  static const int padding{10};
-  static const Vector2 rawPosition{float(screenWidth) - padding, padding};
-  // Offset coordinates to right align texture
-  Vector2 position = rawPosition - Vector2{float(surface->w), 0};
-
-  // Get the destination rect
-  SDL_Rect destinationRect{int(position.x), int(position.y), surface->w, surface->h};
-
-  // Get clip rectangle
-  SDL_Rect clipRect{0, 0, surface->w, surface->h};
-
-  // Put the texture in the renderer
-  SDL_RenderCopyEx(
-      GetRenderer(),
-      texture.get(),
-      &clipRect,
-      &destinationRect,
-      0,
-      nullptr,
-      SDL_FLIP_NONE);
+  glyphAtlas->Draw(text, position, Color::Yellow());
 }
 #endif
 
@@ -251,6 +347,16 @@ Game &Game::GetInstance()
   return *Game::gameInstance;
 }
 
+void Game::Shutdown()
+{
+  if (gameInstance == nullptr)
+    return;
+
+  // Objects destroyed along with it still get the instance, so it must only be forgotten once it's gone
+  delete gameInstance.get();
+  gameInstance.release();
+}
+
 void Game::Start()
 {
   // Push next scene in if necessary
@@ -262,67 +368,140 @@ void Game::Start()
   // Start the initial scene
   GetScene()->Start();
 
-  GameLoop();
+  if (headlessOptions.enabled)
+    HeadlessLoop();
+  else
+    GameLoop();
 }
 
 void Game::GameLoop()
 {
-  // Amount of milliseconds between each frame
-  const int frameDelay = 1000 / Game::frameRate;
+  // Ticks between each frame & physics frame
+  const Uint64 frameInterval = GetFrameInterval();
+  const Uint64 physicsInterval = Clock::GetFrequency() / Game::physicsFrameRate;
 
-  // Amount of milliseconds between each physics frame
-  const int physicsDelay = 1000 / Game::physicsFrameRate;
+  // When the next of each is due
+  Uint64 nextFrameAt = Clock::Now();
+  Uint64 nextPhysicsFrameAt = nextFrameAt;
 
-  // Milliseconds until next frame
-  int nextFrameIn{0};
-
-  // Milliseconds until next physics frame
-  int nextPhysicsFrameIn{0};
+#ifdef DISPLAY_REAL_FPS
+  Uint64 lastLoopStart = Clock::Now();
+#endif
 
-  // Calculate how long each loop will take to execute
-  int executionStart = SDL_GetTicks();
+#ifdef PRINT_FRAME_PACING
+  Uint64 nextReportAt = Clock::Now() + Clock::GetFrequency();
+#endif
 
   // Loop while exit not requested
   while (GetScene()->QuitRequested() == false)
   {
 #ifdef DISPLAY_REAL_FPS
-    CountElapsedFrames(SDL_GetTicks() - executionStart);
+    auto loopStart = Clock::Now();
+    CountElapsedFrames(loopStart - lastLoopStart);
+    lastLoopStart = loopStart;
 #endif
 
-    executionStart = SDL_GetTicks();
-
-    if (nextPhysicsFrameIn <= 0)
+    if (Clock::Now() >= nextPhysicsFrameAt)
     {
       PhysicsFrame();
-      nextPhysicsFrameIn = physicsDelay;
+      nextPhysicsFrameAt = Reschedule(nextPhysicsFrameAt, physicsInterval);
     }
 
-    if (nextFrameIn <= 0)
+    if (Clock::Now() >= nextFrameAt)
     {
       Frame();
-      nextFrameIn = frameDelay;
+      nextFrameAt = Reschedule(nextFrameAt, frameInterval);
     }
 
-    // Check how long this loop was
-    int loopDuration = (int)SDL_GetTicks() - executionStart;
+#ifdef PRINT_FRAME_PACING
+    if (Clock::Now() >= nextReportAt)
+    {
+      auto timings = frameTimings.GetPercentiles();
 
-    // Discount from each counter
-    nextFrameIn -= loopDuration;
-    nextPhysicsFrameIn -= loopDuration;
+      MESSAGE << "Frame intervals: p50 " << timings.p50 << " ms, p95 " << timings.p95 << " ms, p99 " << timings.p99
+              << " ms, max " << timings.max << " ms" << endl;
 
-    // Check how long to wait until next loop
-    int sleepTime = min(nextFrameIn, nextPhysicsFrameIn);
+      nextReportAt = Reschedule(nextReportAt, Clock::GetFrequency());
+    }
+#endif
 
-    if (sleepTime > 0)
-    {
-      // Discount sleep time
-      nextFrameIn -= sleepTime;
-      nextPhysicsFrameIn -= sleepTime;
+    // Sleep until whichever is due first
+    Clock::WaitUntil(min(nextFrameAt, nextPhysicsFrameAt));
+  }
+
+  // Wait for the last frame to be presented
+  renderThread->Finish();
+
+  // Make scene is destroyed
+  if (currentScene)
+    currentScene->Destroy();
+
+  // Clear resources
+  Resources::ClearAll();
+}
+
+void Game::HeadlessLoop()
+{
+  // Amount of milliseconds between each frame
+  const int frameDelay = 1000 / Game::frameRate;
+
+  // Amount of milliseconds between each physics frame
+  const int physicsDelay = 1000 / Game::physicsFrameRate;
+
+  // Simulated time of next frame & physics frame
+  int nextFrameAt{0};
+  int nextPhysicsFrameAt{0};
+
+  frameStart = physicsFrameStart = 0;
+  simulatedTicks = 0;
+
+  // Real time spent in frames, for measuring render cost
+  Uint64 framePerformanceCounts{0};
 
-      SDL_Delay(sleepTime);
+  // Combination of all frame hashes
+  uint64_t runHash{0};
+
+  auto frameLimit = headlessOptions.frameLimit;
+
+  // Run whichever frame comes first in simulated time, until the frame limit is reached
+  while (GetScene()->QuitRequested() == false && (frameLimit == 0 || currentFrame < frameLimit))
+  {
+    if (nextPhysicsFrameAt <= nextFrameAt)
+    {
+      simulatedTicks = nextPhysicsFrameAt;
+      PhysicsFrame();
+      nextPhysicsFrameAt += physicsDelay;
+      continue;
     }
+
+    simulatedTicks = nextFrameAt;
+
+    auto frameStartCount = SDL_GetPerformanceCounter();
+
+    Frame();
+
+    framePerformanceCounts += SDL_GetPerformanceCounter() - frameStartCount;
+
+    runHash = runHash * 31 + CaptureFrame();
+
+    nextFrameAt += frameDelay;
   }
 
+  // Report
+  double frameMs = currentFrame == 0 ? 0 : double(framePerformanceCounts) * 1000 / SDL_GetPerformanceFrequency() / currentFrame;
+
+  MESSAGE << "Headless run rendered " << currentFrame << " frames, averaging " << frameMs << " ms per frame" << endl;
+
+  if (headlessOptions.hashFrames)
+    MESSAGE << "Run hash: " << hex << runHash << dec << endl;
+
+#ifdef PROFILE_FRAMES
+  Profiler::ExportTrace("./profile-headless.json");
+#endif
+
+  // Wait for the last frame to be presented
+  renderThread->Finish();
+
   // Make scene is destroyed
   if (currentScene)
     currentScene->Destroy();
@@ -331,10 +510,86 @@ void Game::GameLoop()
   Resources::ClearAll();
 }
 
+Uint64 Game::GetTime() const
+{
+  if (headlessOptions.enabled)
+    return Uint64(simulatedTicks) * Clock::GetFrequency() / 1000;
+
+  return Clock::Now();
+}
+
+Uint64 Game::GetFrameInterval() const
+{
+  Uint64 interval = Clock::GetFrequency() / Game::frameRate;
+
+#ifdef VSYNC_PACING
+  SDL_DisplayMode mode;
+
+  // Round it to whole refreshes, so each frame is presented on the first vsync after it's due
+  // Refresh rates are reported rounded, and presenting waits for the actual vsync, which absorbs the difference
+  if (window != nullptr && SDL_GetWindowDisplayMode(window.get(), &mode) == 0 && mode.refresh_rate > 0)
+  {
+    Uint64 refresh = Clock::GetFrequency() / mode.refresh_rate;
+
+    interval = max<Uint64>(1, (interval + refresh / 2) / refresh) * refresh;
+  }
+#endif
+
+  return interval;
+}
+
+uint64_t Game::CaptureFrame()
+{
+  if (headlessOptions.hashFrames == false && headlessOptions.dumpDirectory.empty())
+    return 0;
+
+  // Presenting flushed all rendering, so the surface holds the frame
+  auto surface = offscreenSurface.get();
+
+  if (SDL_MUSTLOCK(surface))
+    SDL_LockSurface(surface);
+
+  // FNV-1a over each row's pixels, skipping row padding
+  uint64_t hash{14695981039346656037ull};
+
+  auto rowBytes = surface->w * surface->format->BytesPerPixel;
+
+  for (int row{0}; row < surface->h; row++)
+  {
+    auto pixels = static_cast<const Uint8 *>(surface->pixels) + row * surface->pitch;
+
+    for (int byte{0}; byte < rowBytes; byte++)
+    {
+      hash ^= pixels[byte];
+      hash *= 1099511628211ull;
+    }
+  }
+
+  if (SDL_MUSTLOCK(surface))
+    SDL_UnlockSurface(surface);
+
+  if (headlessOptions.hashFrames)
+    MESSAGE << "Frame " << currentFrame - 1 << " hash: " << hex << hash << dec << endl;
+
+  if (headlessOptions.dumpDirectory.empty() == false)
+  {
+    char fileName[32];
+    snprintf(fileName, sizeof(fileName), "frame_%05lu.bmp", currentFrame - 1);
+
+    string path = headlessOptions.dumpDirectory + "/" + fileName;
+
+    Assert(SDL_SaveBMP(surface, path.c_str()) == 0, "Failed to dump frame to " + path);
+  }
+
+  return hash;
+}
+
 void Game::Frame()
 {
+  PROFILE_ZONE("Game::Frame");
+
 #ifdef PRINT_FRAME_DURATION
-  float startMs = SDL_GetTicks();
+  auto startTime = Clock::Now();
 #endif
 
 #ifdef DISPLAY_REAL_FPS
@@ -345,16 +600,25 @@ void Game::Frame()
   // Load next scene if necessary
   TransitionScenes();
 
+  // Store assets which finished loading in the background
+  Resources::CompleteLoads();
+
   // Get input
-  auto pollDelay = inputManager.Update();
+  inputManager.Update();
 
-  // Discount poll delay from delta times (convert seconds to ms)
-  frameStart += pollDelay * 1000;
-  physicsFrameStart += pollDelay * 1000;
+#ifdef PROFILE_FRAMES
+  // Export the latest frames' zones
+  if (inputManager.KeyPress(SDLK_F4))
+    Profiler::ExportTrace("./profile-" + to_string(currentFrame) + ".json");
+#endif
 
   // Calculate frame's delta time
   CalculateDeltaTime(frameStart, deltaTime);
 
+  // Simulated frames are perfectly paced
+  if (headlessOptions.enabled == false)
+    frameTimings.Record(deltaTime * 1000);
+
   // Update the scene's timer
   currentScene->timer.Update(deltaTime);
 
@@ -364,16 +628,43 @@ void Game::Frame()
   // Render the scene
   currentScene->Render();
 
+  // Debug drawings go on top of it
+  Debug::Flush();
+
 #ifdef DISPLAY_REAL_FPS
   // Render frame count
   DisplayRealFps();
 #endif
 
-  // Render the window
-  SDL_RenderPresent(GetRenderer());
+  // Record whatever is left in the batch
+  spriteBatch.Flush();
+
+  // Hand the frame over to be rendered to the window
+  renderThread->Submit();
+
+  // Close this frame's stats
+  [[maybe_unused]] auto batchStats = spriteBatch.EndFrame();
+
+#ifdef PRINT_STARTUP_TIME
+  if (currentFrame == 0)
+    MESSAGE << "First frame submitted "
+            << Clock::ToMilliseconds(Clock::Now() - startupCounter)
+            << " ms after startup, reading assets from " << (AssetArchive::IsOpen() ? "the archive" : "loose files") << endl;
+#endif
+
+#ifdef PRINT_DRAW_CALLS
+  auto renderStats = currentScene->GetRenderStats();
+
+  // These are from the last presented frame, which may be the previous one
+  auto contextStats = renderThread->GetLastContextStats();
+
+  MESSAGE << "Frame submitted " << batchStats.quads << " quads in " << batchStats.drawCalls << " draw calls, "
+          << renderStats.culled << " out of " << renderStats.drawn + renderStats.culled << " checked for view were culled, "
+          << contextStats.applied << " out of " << contextStats.requested << " state changes were applied" << endl;
+#endif
 
 #ifdef PRINT_FRAME_DURATION
-  MESSAGE << "Frame took " << float(SDL_GetTicks()) - startMs << " ms" << endl;
+  MESSAGE << "Frame took " << Clock::ToMilliseconds(Clock::Now() - startTime) << " ms" << endl;
 #endif
 
   // Increment counter
@@ -382,8 +673,10 @@ void Game::Frame()
 
 void Game::PhysicsFrame()
 {
+  PROFILE_ZONE("Game::PhysicsFrame");
+
 #ifdef PRINT_FRAME_DURATION
-  float startMs = SDL_GetTicks();
+  auto startTime = Clock::Now();
 #endif
 
 #ifdef DISPLAY_REAL_FPS
@@ -398,7 +691,7 @@ void Game::PhysicsFrame()
   GetScene()->PhysicsUpdate(physicsDeltaTime);
 
 #ifdef PRINT_FRAME_DURATION
-  MESSAGE << "Physics took " << float(SDL_GetTicks()) - startMs << " ms" << endl;
+  MESSAGE << "Physics took " << Clock::ToMilliseconds(Clock::Now() - startTime) << " ms" << endl;
 #endif
 
   // Increment counter
@@ -439,6 +732,13 @@ void Game::TransitionScenes()
   // Set new scene
   currentScene = nextScene;
 
+  // Load what the scene is known to use before it starts
+  // Recordings vary between runs, so headless runs only load what's declared
+  Preload(currentScene->GetAssetManifest(headlessOptions.enabled == false));
+
+  // Record only what it actually uses from now on
+  Resources::ResetRecordedAssets();
+
   // Add new objects
   for (auto newObject : objectsToKeep)
   {
@@ -456,3 +756,95 @@ void Game::TransitionScenes()
   // Reset variable
   nextScene = nullptr;
 }
+
+void Game::Preload(const AssetManifest &manifest)
+{
+  PROFILE_ZONE("Game::Preload");
+
+  if (manifest.Count() == 0)
+    return;
+
+  float total = manifest.Count();
+  size_t loaded{0};
+
+  // Start decoding everything
+  vector<shared_ptr<AssetRequest>> requests;
+
+  for (auto &filename : manifest.images)
+    requests.push_back(Resources::LoadImageAsync(filename));
+
+  for (auto &filename : manifest.sounds)
+    requests.push_back(Resources::LoadSoundAsync(filename));
+
+  for (auto &filename : manifest.music)
+    requests.push_back(Resources::LoadMusicAsync(filename));
+
+  // Meanwhile, fonts can only be loaded here
+  for (auto &[filename, size] : manifest.fonts)
+  {
+    Resources::GetGlyphAtlas(filename, size);
+
+    DisplayLoadingProgress(++loaded / total);
+  }
+
+  // Wait for the workers, uploading images within budget each step
+  auto IsDone = [](const shared_ptr<AssetRequest> &request)
+  { return request->IsDone(); };
+
+  size_t decoded{0};
+
+  while (decoded < requests.size())
+  {
+    // Keep the window responsive, and let the player quit instead of waiting
+    inputManager.Update();
+
+    if (inputManager.QuitRequested())
+    {
+      currentScene->RequestQuit();
+      return;
+    }
+
+    Resources::CompleteLoads();
+
+    decoded = count_if(requests.begin(), requests.end(), IsDone);
+
+    DisplayLoadingProgress((loaded + decoded) / total);
+
+    if (decoded < requests.size())
+      SDL_Delay(1);
+  }
+
+  loaded += decoded;
+
+  // With images in the atlas, clipping sprites is quick, so progress is shown only now and then
+  for (auto &sprite : manifest.sprites)
+  {
+    Resources::GetSprite(sprite.filename, sprite.clip);
+
+    if (++loaded % 64 == 0)
+      DisplayLoadingProgress(loaded / total);
+  }
+
+  DisplayLoadingProgress(1);
+}
+
+void Game::DisplayLoadingProgress(float progress)
+{
+  static const float barWidth{screenWidth / 2.0f};
+  static const float barHeight{12};
+
+  SDL_FRect bar{(screenWidth - barWidth) / 2, (screenHeight - barHeight) / 2, barWidth, barHeight};
+
+  renderThread->GetRecordingList().Clear(Color::Black());
+
+  spriteBatch.Fill(bar, Color(40, 40, 40));
+
+  bar.w *= progress;
+  spriteBatch.Fill(bar, Color::White());
+
+  spriteBatch.Flush();
+
+  renderThread->Submit();
+
+  spriteBatch.EndFrame();
+}
@@ -2,13 +2,16 @@
 #include "GameObject.h"
 #include "Sound.h"
 #include "Game.h"
+#include "ComponentProfiler.h"
 #include <iostream>
 
 using namespace std;
 
+HandleTable<GameObject> GameObject::handleTable;
+
 // Private constructor
 GameObject::GameObject(string name, int gameSceneId, int id)
-    : id(id >= 0 ? id : Game::GetInstance().SupplyId()), name(name), gameSceneId(gameSceneId)
+    : id(id >= 0 ? id : Game::GetInstance().SupplyId()), handle(handleTable.Insert(this)), name(name), gameSceneId(gameSceneId)
 {
 }
 
@@ -18,6 +21,8 @@ GameObject::GameObject(string name)
 
 GameObject::~GameObject()
 {
+  handleTable.Remove(handle);
+
   MESSAGE << "In destructor of " << *this << endl;
 
   // Detect leaked components
@@ -67,11 +72,8 @@ void GameObject::Update(float deltaTime)
   // Apply timescale
   deltaTime *= GetTimeScale();
 
-  // Update timers
-  timer.Update(deltaTime);
-
-  // Trigger delayed functions
-  TriggerDelayedFunctions();
+  // Advance own clock
+  simulationTime += deltaTime;
 
   if (enabled == false)
     return;
@@ -79,7 +81,10 @@ void GameObject::Update(float deltaTime)
   for (auto [componentId, component] : components)
   {
     if (component->IsEnabled())
+    {
+      PROFILE_COMPONENT(*component, Update);
       component->Update(deltaTime);
+    }
   }
 }
 
@@ -93,7 +98,10 @@ void GameObject::PhysicsUpdate(float deltaTime)
   for (auto [componentId, component] : components)
   {
     if (component->IsEnabled())
+    {
+      PROFILE_COMPONENT(*component, PhysicsUpdate);
       component->PhysicsUpdate(deltaTime);
+    }
   }
 }
 
@@ -103,7 +111,7 @@ float GameObject::GetTimeScale() const
   if (IsRoot())
     return localTimeScale;
 
-  return InternalGetParent()->GetTimeScale() * localTimeScale;
+  return InternalResolveParent().GetTimeScale() * localTimeScale;
 }
 
 void GameObject::SetTimeScale(float newScale)
@@ -111,18 +119,23 @@ void GameObject::SetTimeScale(float newScale)
   Assert(newScale > 0, "Time must flow forward");
 
   if (IsRoot())
-  {
     localTimeScale = newScale;
-    return;
-  }
 
-  float parentTimeScale{InternalGetParent()->GetTimeScale()};
+  else
+  {
+    float parentTimeScale{InternalGetParent()->GetTimeScale()};
+
+    Assert(parentTimeScale > 0, "Parent timeScale is invalid");
 
-  Assert(parentTimeScale > 0, "Parent timeScale is invalid");
+    localTimeScale = newScale / parentTimeScale;
+  }
 
-  localTimeScale = newScale / parentTimeScale;
+  // Delayed functions of this object and it's descendants are now due at different times
+  GetScene()->scheduler.Retime();
 }
 
+double GameObject::GetSimulationTime() const { return simulationTime; }
+
 void GameObject::InternalDestroy()
 {
   // for (auto [componentId, component] : components)
@@ -187,64 +200,28 @@ bool GameObject::IsEnabled() const
   if (IsRoot())
     return true;
 
-  return InternalGetParent()->IsEnabled();
-}
-
-void GameObject::TriggerDelayedFunctions()
-{
-  auto delayedFunctionEntryIterator = delayedFunctions.begin();
-  while (delayedFunctionEntryIterator != delayedFunctions.end())
-  {
-    auto stringTokenId = to_string(delayedFunctionEntryIterator->first);
-
-    // Check if it was disabled
-    if (delayedFunctionEntryIterator->second.second == false)
-      // Remove it
-      delayedFunctionEntryIterator = delayedFunctions.erase(delayedFunctionEntryIterator);
-
-    // Check if delay is up
-    else if (timer.Get(stringTokenId) >= 0)
-    {
-      auto delayedFunction = delayedFunctionEntryIterator->second.first;
-
-      // Scrap timer
-      timer.Scrap(stringTokenId);
-
-      // Trigger function
-      delayedFunction();
-
-      // Forget entry
-      delayedFunctionEntryIterator = delayedFunctions.erase(delayedFunctionEntryIterator);
-    }
-
-    else
-      delayedFunctionEntryIterator++;
-  }
+  return InternalResolveParent().IsEnabled();
 }
 
 int GameObject::DelayFunction(function<void()> procedure, float seconds)
 {
-  // Get token id
-  int tokenId = HashTwo(SDL_GetTicks(), RandomRange(0, 10000));
-
-  // Store function
-  delayedFunctions[tokenId] = {procedure, true};
+  return GetScene()->scheduler.Schedule(procedure, seconds, handle);
+}
 
-  // Start timer
-  timer.Reset(to_string(tokenId), -seconds);
+void GameObject::CancelDelayedFunction(int tokenId) { GetScene()->scheduler.Cancel(tokenId); }
 
-  return tokenId;
-}
+bool GameObject::DestroyRequested() const { return destroyRequested; }
 
-void GameObject::CancelDelayedFunction(int tokenId)
+void GameObject::RequestDestroy()
 {
-  // Set it as not supposed to be called
-  delayedFunctions[tokenId].second = false;
-}
+  if (destroyRequested)
+    return;
 
-bool GameObject::DestroyRequested() const { return destroyRequested; }
+  SetEnabled(false), destroyRequested = true;
 
-void GameObject::RequestDestroy() { SetEnabled(false), destroyRequested = true; }
+  // Queue it for collection
+  GetScene()->destroyQueue.push_back(handle);
+}
 
 std::string GameObject::GetName() const { return name; }
 
@@ -261,6 +238,17 @@ shared_ptr<GameObject> GameObject::InternalGetParent() const
   return parent;
 }
 
+GameObject &GameObject::InternalResolveParent() const
+{
+  auto parent = Resolve(parentHandle);
+
+  // Only build the message when it's needed
+  if (parent == nullptr)
+    Assert(false, "Failed to resolve parent of " + string(*this));
+
+  return *parent;
+}
+
 void GameObject::OnBeforeDestroy()
 {
 }
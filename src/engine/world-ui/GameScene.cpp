@@ -6,6 +6,9 @@
 #include "Camera.h"
 #include "Resources.h"
 #include "Parent.h"
+#include "Animation.h"
+#include "Profiler.h"
+#include "ComponentProfiler.h"
 #include <iostream>
 
 #define CASCADE_OBJECTS(method, param) CascadeDown([param](GameObject &object) { object.method(param); });
@@ -39,40 +42,71 @@ void GameScene::CascadeDown(function<void(GameObject &)> callback, bool topDown)
 
 void GameScene::CollectDeadObjects()
 {
-  // Check for dead objects
+  if (destroyQueue.empty())
+    return;
+
+  // Take this batch. Objects which request destruction while it's being destroyed are left for the next collection
+  vector<Handle> batch;
+  batch.swap(destroyQueue);
+
+  // Hold them weakly: an object torn down along with an ancestor must only be referenced by it's own teardown
   vector<weak_ptr<GameObject>> deadObjects;
+  deadObjects.reserve(batch.size());
 
-  // Collect them
-  for (auto &objectPair : gameObjects)
+  // Ids of every object going away, descendants included
+  vector<int> deadObjectIds;
+
+  for (auto handle : batch)
   {
-    // If is dead, collect
-    if (objectPair.second->DestroyRequested())
-    {
-      deadObjects.emplace_back(objectPair.second);
-    }
+    auto deadObject = GameObject::Resolve(handle);
 
-    // Not a good idea to delete them here directly, as it would invalidate this loop's iterator
+    // Ignore objects that were already removed from the scene
+    if (deadObject == nullptr || gameObjects.count(deadObject->id) == 0)
+      continue;
+
+    deadObjects.emplace_back(gameObjects[deadObject->id]);
   }
 
-  // Erase them
+  // Tear down components and remove objects from the scene
   for (auto &weakObject : deadObjects)
     IF_LOCK(weakObject, deadObject)
     {
+      // It may have been destroyed along with an ancestor
+      if (gameObjects.count(deadObject->id) == 0)
+        continue;
+
+      deadObject->CascadeDown([&deadObjectIds](GameObject &object)
+                              { deadObjectIds.push_back(object.id); });
+
       deadObject->InternalDestroy();
     }
+
+  // Let each subsystem forget them in a single pass
+  physicsSystem.UnregisterObjects(deadObjectIds);
+  PruneRenderables();
 }
 
 void GameScene::Update(float deltaTime)
 {
+  PROFILE_ZONE("GameScene::Update");
+
   // Quit if necessary
   if (inputManager.QuitRequested())
   {
     quitRequested = true;
   }
 
+#ifdef PHYSICS_OVERLAY
+  if (inputManager.KeyPress(SDLK_F3))
+    physicsSystem.showOverlay = !physicsSystem.showOverlay;
+#endif
+
   // Update world objects
   CASCADE_OBJECTS(Update, deltaTime);
 
+  // Execute delayed functions which are due
+  scheduler.Update(deltaTime);
+
   // Delete dead ones
   CollectDeadObjects();
 
@@ -83,6 +117,8 @@ void GameScene::Update(float deltaTime)
 
 void GameScene::PhysicsUpdate(float deltaTime)
 {
+  PROFILE_ZONE("GameScene::PhysicsUpdate");
+
   // Physics update
   CASCADE_OBJECTS(PhysicsUpdate, deltaTime);
 
@@ -97,64 +133,162 @@ void GameScene::PhysicsUpdate(float deltaTime)
 
 void GameScene::Render()
 {
+  PROFILE_ZONE("GameScene::Render");
+
   // Clear screen
   auto back = Camera::GetMain()->background;
-  auto renderer = Game::GetInstance().GetRenderer();
 
-  SDL_SetRenderDrawColor(renderer, back.red, back.green, back.blue, 255);
-  SDL_RenderClear(renderer);
+  back.alpha = 255;
+  Game::GetInstance().GetRenderThread().GetRecordingList().Clear(back);
+
+  // Get view to cull against
+  cullingView = Camera::GetMain()->ToRectangle();
+  cullingView.width += Camera::cullingMargin * 2;
+  cullingView.height += Camera::cullingMargin * 2;
+
+  renderStats = RenderStats();
 
   // Foreach layer
   for (int layer{0}; layer != (int)RenderLayer::None; layer++)
   {
     // Get the layer's Renderables
-    auto &renderables = layerStructure[(RenderLayer)layer];
+    auto &entries = layerStructure[(RenderLayer)layer];
 
     // Sort them
-    Sort(renderables);
+    Sort(entries);
 
-    // For each Renderable in this layer
-    auto renderableIterator{renderables.begin()};
+    // Render them
+    if (auto cache = layerCaches.find((RenderLayer)layer); cache != layerCaches.end())
+      RenderCachedLayer(entries, cache->second);
+    else
+      RenderEntries(entries);
+  }
 
-    while (renderableIterator != renderables.end())
-    {
-      // Lock the Renderable
-      if (auto renderable = renderableIterator->lock())
-      {
-        // Render it
-        if (renderable->ShouldRender())
-          renderable->Render();
-
-        // Advance
-        renderableIterator++;
-      }
-      // If lock fails, it was erased, so remove it
-      else
-      {
-        renderableIterator = renderables.erase(renderableIterator);
-      }
-    }
+  if (physicsSystem.showOverlay)
+    physicsSystem.DrawOverlay();
+}
+
+void GameScene::RenderEntries(const vector<RenderEntry> &entries)
+{
+  for (auto &entry : entries)
+  {
+    auto renderable = Renderable::Resolve(entry.renderable);
+
+    if (renderable == nullptr || renderable->ShouldRender() == false)
+      continue;
+
+    // Skip it if it's out of view
+    Rectangle bounds;
+
+    if (renderable->GetWorldBounds(bounds) && Cull(bounds))
+      continue;
+
+    PROFILE_COMPONENT(*renderable, Render);
+    renderable->Render();
   }
 }
 
-void GameScene::Sort(vector<weak_ptr<Renderable>> &renderables)
+void GameScene::RenderCachedLayer(const vector<RenderEntry> &entries, LayerCache &cache)
 {
-  // Renderable comparer
-  // Must return true iff first parameter comes before second parameter
-  auto comparer = [](weak_ptr<Renderable> comp1Weak, weak_ptr<Renderable> comp2Weak)
+  auto camera = Camera::GetMain();
+
+  // Sign the layer's content, so any change to it is noticed
+  size_t signature{entries.size()};
+
+  for (auto &entry : entries)
   {
-    auto comp1 = comp1Weak.lock();
-    auto comp2 = comp2Weak.lock();
+    auto renderable = Renderable::Resolve(entry.renderable);
 
-    // Treat them as equal if any of them is null
-    if (comp1 == nullptr || comp2 == nullptr)
-      return false;
+    if (renderable == nullptr)
+      continue;
+
+    signature = signature * 31 + entry.renderable.value;
+    signature = signature * 31 + renderable->GetContentVersion();
+    signature = signature * 31 + renderable->ShouldRender();
+  }
+
+  if (cache.NeedsCompose(*camera, signature))
+  {
+    cache.BeginCompose(*camera, signature);
+
+    // Cull against the whole texture instead of the screen
+    auto screenView = cullingView;
+    cullingView.width += LayerCache::margin * 2 * camera->GetUnitsPerRealPixel();
+    cullingView.height += LayerCache::margin * 2 * camera->GetUnitsPerRealPixel();
+
+    RenderEntries(entries);
+
+    cullingView = screenView;
+
+    cache.EndCompose();
+  }
+
+  cache.Draw(*camera);
+}
 
-    return comp1->GetRenderOrder() < comp2->GetRenderOrder();
-  };
+void GameScene::CacheLayer(RenderLayer layer, float parallax) { layerCaches[layer] = LayerCache(parallax); }
+
+bool GameScene::Cull(const Rectangle &bounds) { return Cull(bounds.center, bounds.width, bounds.height); }
+
+bool GameScene::Cull(Vector2 center, float width, float height)
+{
+  bool outOfView = abs(center.x - cullingView.center.x) > (width + cullingView.width) / 2 ||
+                   abs(center.y - cullingView.center.y) > (height + cullingView.height) / 2;
+
+  if (outOfView)
+    renderStats.culled++;
+  else
+    renderStats.drawn++;
+
+  return outOfView;
+}
+
+GameScene::RenderStats GameScene::GetRenderStats() const { return renderStats; }
+
+void GameScene::PruneRenderables()
+{
+  auto isDestroyed = [](const RenderEntry &entry)
+  { return Renderable::Resolve(entry.renderable) == nullptr; };
+
+  for (auto &[layer, entries] : layerStructure)
+    entries.erase(remove_if(entries.begin(), entries.end(), isDestroyed), entries.end());
+}
+
+void GameScene::Sort(vector<RenderEntry> &entries)
+{
+  bool sorted{true};
+
+  // Refresh cached orders in a single pass, compacting out entries which no longer resolve
+  size_t keptCount{0};
+
+  for (size_t index{0}; index < entries.size(); index++)
+  {
+    auto renderable = Renderable::Resolve(entries[index].renderable);
+
+    if (renderable == nullptr)
+      continue;
+
+    auto &entry = entries[keptCount] = entries[index];
+    entry.renderOrder = renderable->GetRenderOrder();
+
+    if (keptCount > 0 && entries[keptCount - 1].renderOrder > entry.renderOrder)
+      sorted = false;
+
+    keptCount++;
+  }
+
+  entries.resize(keptCount);
+
+  if (sorted)
+    return;
+
+  // Entry comparer
+  // Must return true iff first parameter comes before second parameter
+  auto comparer = [](const RenderEntry &entry1, const RenderEntry &entry2)
+  { return entry1.renderOrder < entry2.renderOrder; };
 
   // Sort it, preserving layer register order for equivalent members
-  stable_sort(renderables.begin(), renderables.end(), comparer);
+  stable_sort(entries.begin(), entries.end(), comparer);
 }
 
 void GameScene::Start()
@@ -212,17 +346,13 @@ shared_ptr<GameObject> GameScene::RegisterObject(shared_ptr<GameObject> gameObje
 
 shared_ptr<GameObject> GameScene::RegisterObject(GameObject *gameObject) { return RegisterObject(shared_ptr<GameObject>(gameObject)); }
 
-void GameScene::RegisterLayerRenderer(shared_ptr<Renderable> renderable)
+void GameScene::RegisterLayerRenderer(Renderable &renderable)
 {
-  // Simply ignore invalid requests
-  if (!renderable)
-    return;
-
   // Get it's layer
-  auto &layer = layerStructure[renderable->GetRenderLayer()];
+  auto &entries = layerStructure[renderable.GetRenderLayer()];
 
-  // Add it's entry
-  layer.emplace_back(renderable);
+  // Add it's entry. If it breaks the order, the next sort will notice
+  entries.push_back({renderable.renderHandle, renderable.GetRenderOrder()});
 }
 
 shared_ptr<GameObject> GameScene::GetGameObject(int id)
@@ -348,6 +478,20 @@ std::shared_ptr<WorldObject> GameScene::RequireWorldObject(std::string name)
 
 std::shared_ptr<WorldObject> GameScene::GetRootObject() { return rootObject; }
 
+AssetManifest GameScene::GetAssetManifest(bool includeRecorded)
+{
+  AssetManifest manifest;
+
+  if (includeRecorded)
+    manifest = AssetManifest::Load(GetManifestPath());
+
+  DeclareAssets(manifest);
+
+  return manifest;
+}
+
+string GameScene::GetManifestPath() const { return "./assets/" + GetName() + ".manifest"; }
+
 void GameScene::Destroy()
 {
   // Destroy root object
@@ -356,8 +500,36 @@ void GameScene::Destroy()
   // Ensure they were all destroyed
   Assert(gameObjects.size() == 0, "Failed to destroy all objects before destroying scene");
 
-  // Clear unused resources
-  Resources::ClearAll();
+#ifdef RECORD_ASSET_MANIFESTS
+  // Remember what was used, so it's preloaded next time
+  auto manifest = AssetManifest::Load(GetManifestPath());
+  manifest.Merge(Resources::GetRecordedAssets());
+
+  if (manifest.Save(GetManifestPath()) == false)
+    MESSAGE << "WARNING: Failed to record asset manifest at " << GetManifestPath() << endl;
+#endif
+
+  // Release sliced spritesheets, so their sprites can be cleared
+  Animation::ClearSliceCache();
+
+  // Release samples, so their chunks can be cleared. Every sound was stopped along with it's object
+  Game::GetInstance().GetVoiceManager().StopAll();
+  SoundBank::Release();
+
+  // Evict unused resources only if they exceed the budget, so the next scene may reuse them
+  Resources::Trim();
+
+#ifdef PROFILE_COMPONENTS
+  // Report what this scene's components cost
+  auto profilePath = "./components-" + GetName() + ".csv";
+
+  ComponentProfiler::PrintTable(MESSAGE);
+
+  if (ComponentProfiler::ExportCsv(profilePath))
+    MESSAGE << "Exported component costs to " << profilePath << endl;
+
+  ComponentProfiler::Reset();
+#endif
 
   nameBeforeDestruction = GetName();
 }
@@ -0,0 +1,78 @@
+#include "GlyphAtlas.h"
+#include "Game.h"
+#include "Helper.h"
+
+using namespace std;
+using namespace Helper;
+
+GlyphAtlas::GlyphAtlas(shared_ptr<TTF_Font> font, TextureAtlas &atlas) : font(font), atlas(atlas) {}
+
+const GlyphAtlas::Glyph &GlyphAtlas::GetGlyph(unsigned char character, int outline)
+{
+  int key = outline << 8 | character;
+
+  auto glyphIterator = glyphs.find(key);
+
+  if (glyphIterator != glyphs.end())
+    return glyphIterator->second;
+
+  // Get advance from the plain glyph
+  int advance{0};
+  TTF_GlyphMetrics(font.get(), character, nullptr, nullptr, nullptr, nullptr, &advance);
+
+  // Render it in white, so any color can be applied later
+  TTF_SetFontOutline(font.get(), outline);
+
+  auto_unique_ptr<SDL_Surface> surface(TTF_RenderGlyph_Solid(font.get(), character, Color::White()), SDL_FreeSurface);
+
+  TTF_SetFontOutline(font.get(), 0);
+
+  // Glyphs with nothing to show (such as spaces) may fail to render, in which case they only advance the pen
+  if (surface == nullptr || surface->w == 0)
+    return glyphs[key] = Glyph{TextureAtlas::Region{nullptr, SDL_Rect{0, 0, 0, 0}}, advance};
+
+  return glyphs[key] = Glyph{atlas.Pack(surface.get()), advance};
+}
+
+int GlyphAtlas::MeasureWidth(const string &text, int outline)
+{
+  int width{0};
+
+  for (unsigned char character : text)
+    width += GetGlyph(character, 0).advance;
+
+  return width + outline * 2;
+}
+
+int GlyphAtlas::MeasureHeight(int outline) const { return TTF_FontHeight(font.get()) + outline * 2; }
+
+void GlyphAtlas::Draw(const string &text, Vector2 position, Color color, int outline, Color outlineColor)
+{
+  // Outlined glyphs grow by the outline on each side, so the plain ones go in their middle
+  if (outline > 0)
+  {
+    DrawGlyphs(text, position, outlineColor, outline);
+    position += Vector2(outline, outline);
+  }
+
+  DrawGlyphs(text, position, color, 0);
+}
+
+void GlyphAtlas::DrawGlyphs(const string &text, Vector2 position, Color color, int outline)
+{
+  auto &spriteBatch = Game::GetInstance().GetSpriteBatch();
+
+  float penX{position.x};
+
+  for (unsigned char character : text)
+  {
+    auto &glyph = GetGlyph(character, outline);
+    auto &rect = glyph.region.rect;
+
+    if (glyph.region.texture != nullptr)
+      spriteBatch.Draw(glyph.region.texture, rect, SDL_FRect{penX, position.y, float(rect.w), float(rect.h)}, color);
+
+    // Outlines don't change spacing
+    penX += GetGlyph(character, 0).advance;
+  }
+}
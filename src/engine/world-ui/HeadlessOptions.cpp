@@ -0,0 +1,62 @@
+#include "HeadlessOptions.h"
+#include "Helper.h"
+#include <cstdlib>
+
+using namespace std;
+using namespace Helper;
+
+HeadlessOptions HeadlessOptions::Parse(int argc, char **argv)
+{
+  HeadlessOptions options;
+
+  // Check environment
+  const char *environmentFlag = getenv("BOTECO_HEADLESS");
+
+  if (environmentFlag != nullptr && string(environmentFlag) != "" && string(environmentFlag) != "0")
+    options.enabled = true;
+
+  // Gets the value which follows the argument at the given index
+  auto getValue = [argc, argv](int &index)
+  {
+    Assert(index + 1 < argc, "Missing value for command line argument " + string(argv[index]));
+
+    return string(argv[++index]);
+  };
+
+  for (int index{1}; index < argc; index++)
+  {
+    string argument{argv[index]};
+
+    if (argument == "--headless")
+      options.enabled = true;
+
+    else if (argument == "--frames")
+    {
+      string value = getValue(index);
+
+      try
+      {
+        options.frameLimit = stoul(value);
+      }
+      catch (const logic_error &)
+      {
+        throw runtime_error("Invalid frame count \"" + value + "\"");
+      }
+    }
+
+    else if (argument == "--hash-frames")
+      options.hashFrames = true;
+
+    else if (argument == "--dump-frames")
+      options.dumpDirectory = getValue(index);
+
+    else
+      MESSAGE << "WARNING: ignoring unknown command line argument " << argument << endl;
+  }
+
+  // Capture options only make sense without a window
+  Assert(options.enabled || (options.hashFrames == false && options.dumpDirectory.empty()),
+         "Frame hashing and dumping require headless mode", "pass --headless as well");
+
+  return options;
+}
@@ -1,5 +1,7 @@
 #include "InputManager.h"
 #include "Camera.h"
+#include "Profiler.h"
+#include "RenderThread.h"
 #include <SDL.h>
 
 #define CONTROLLER_AXIS_MAX 32767.0f
@@ -8,13 +10,6 @@ using namespace std;
 
 const float InputManager::joystickDeadZone{0.1f};
 
-// Maximum seconds an event poll can take before discounting it's duration from deltaTime
-const float maximumPollDuration{0.01f};
-
-// Wraps SDL_PollEvent to also measure how long it took to execute
-// Sums execution duration to the timer variable
-bool PollEventsTimed(SDL_Event *event, float &timer);
-
 // Flattens joystick axis value in range -1 to 1, and sets it to 0 if below deadzone
 float InputManager::TreatAxisValue(int value)
 {
@@ -22,8 +17,10 @@ float InputManager::TreatAxisValue(int value)
   return abs(flattenValue) < joystickDeadZone ? 0 : flattenValue;
 }
 
-float InputManager::Update()
+void InputManager::Update()
 {
+  PROFILE_ZONE("InputManager::Update");
+
   SDL_Event event;
 
   // Get mouse coords
@@ -41,11 +38,15 @@ float InputManager::Update()
   // Game controller mapping for analogs in this frame
   static unordered_map<int, Vector2> currentLeftControllerAnalogs, currentRightControllerAnalogs;
 
-  // How long SDL_PollEvent will take to execute, in total
-  float eventPollingDelay{0};
+  // Pumping events lets SDL's renderer handle resizes, minimizes & restores, so it must not overlap with the render thread
+  {
+    RendererLock lock;
 
-  // If there are any input events in the SDL stack pile, this function returns 1 and sets the argument to next event
-  while (PollEventsTimed(&event, eventPollingDelay))
+    SDL_PumpEvents();
+  }
+
+  // Take every pumped event, without pumping again
+  while (SDL_PeepEvents(&event, 1, SDL_GETEVENT, SDL_FIRSTEVENT, SDL_LASTEVENT) > 0)
   {
     // Quit on quit event
     if (event.type == SDL_QUIT)
@@ -190,24 +191,6 @@ float InputManager::Update()
   // Store for next frame
   lastLeftControllerAnalogs = currentLeftControllerAnalogs;
   lastRightControllerAnalogs = currentRightControllerAnalogs;
-
-  return eventPollingDelay;
-}
-
-bool PollEventsTimed(SDL_Event *event, float &timer)
-{
-  auto start = SDL_GetTicks();
-  bool eventFound = SDL_PollEvent(event);
-  auto end = SDL_GetTicks();
-
-  // Gets duration as seconds
-  float length = float(end - start) / 1000.0f;
-
-  // Add duration to timer
-  if (length > maximumPollDuration)
-    timer += length - maximumPollDuration;
-
-  return eventFound;
 }
 
 void InputManager::OpenController(int index)
@@ -0,0 +1,101 @@
+#include "LayerCache.h"
+#include "Camera.h"
+#include "Game.h"
+
+using namespace std;
+using namespace Helper;
+
+const int LayerCache::margin{128};
+
+LayerCache::LayerCache(float parallax, float sizeTolerance)
+    : parallax(parallax),
+      sizeTolerance(sizeTolerance),
+      width(Game::screenWidth + margin * 2),
+      height(Game::screenHeight + margin * 2) {}
+
+bool LayerCache::NeedsCompose(const Camera &camera, size_t signature) const
+{
+  if (texture == nullptr || signature != composedSignature)
+    return true;
+
+  // Parallaxed renderables resize with the camera in a way scaling the quad can't follow, so they tolerate no drift
+  float tolerance = parallax == 0 ? sizeTolerance : 0;
+
+  // Size drifted too far
+  if (abs(camera.GetSize() - composedSize) > composedSize * tolerance)
+    return true;
+
+  // Texture no longer covers the screen
+  auto rect = GetScreenRect(camera);
+
+  return rect.x > 0 || rect.y > 0 ||
+         rect.x + rect.w < Game::screenWidth || rect.y + rect.h < Game::screenHeight;
+}
+
+void LayerCache::BeginCompose(const Camera &camera, size_t signature)
+{
+  if (texture == nullptr)
+    CreateTexture();
+
+  composedTopLeft = camera.GetTopLeft();
+  composedPosition = camera.GetPosition();
+  composedSize = camera.GetSize();
+  composedPixelsPerUnit = camera.GetRealPixelsPerUnit();
+  composedSignature = signature;
+
+  auto &spriteBatch = Game::GetInstance().GetSpriteBatch();
+  auto &commandList = Game::GetInstance().GetRenderThread().GetRecordingList();
+
+  // Finish what goes to the window
+  spriteBatch.Flush();
+
+  commandList.Target(texture);
+  commandList.Clear(Color(0, 0, 0, 0));
+
+  // The screen's top left is at the margin
+  spriteBatch.SetOffset({float(margin), float(margin)});
+}
+
+void LayerCache::EndCompose()
+{
+  auto &spriteBatch = Game::GetInstance().GetSpriteBatch();
+
+  spriteBatch.Flush();
+  spriteBatch.SetOffset({0, 0});
+
+  Game::GetInstance().GetRenderThread().GetRecordingList().Target(nullptr);
+}
+
+void LayerCache::Draw(const Camera &camera) const
+{
+  Game::GetInstance().GetSpriteBatch().Draw(texture, SDL_Rect{0, 0, width, height}, GetScreenRect(camera));
+}
+
+SDL_FRect LayerCache::GetScreenRect(const Camera &camera) const
+{
+  // World point which was at the texture's top left, displaced by the share of camera movement the parallax follows
+  Vector2 worldTopLeft = composedTopLeft - Vector2(margin, margin) / composedPixelsPerUnit +
+                         (camera.GetPosition() - composedPosition) * parallax;
+
+  Vector2 screenTopLeft = (worldTopLeft - camera.GetTopLeft()) * camera.GetRealPixelsPerUnit();
+
+  // Scale by how much the camera zoomed since
+  float scale = camera.GetRealPixelsPerUnit() / composedPixelsPerUnit;
+
+  return SDL_FRect{screenTopLeft.x, screenTopLeft.y, width * scale, height * scale};
+}
+
+void LayerCache::CreateTexture()
+{
+  // The render thread may be using the renderer
+  RendererLock lock;
+
+  auto newTexture = SDL_CreateTexture(
+      Game::GetInstance().GetRenderer(), SDL_PIXELFORMAT_RGBA32, SDL_TEXTUREACCESS_TARGET, width, height);
+
+  Assert(newTexture != nullptr, "Failed to create layer cache texture");
+
+  texture = shared_ptr<SDL_Texture>(newTexture, RenderThread::DestroyTexture);
+
+  Game::GetInstance().GetRenderContext().SetTextureBlendMode(texture, SDL_BLENDMODE_BLEND);
+}
@@ -0,0 +1,154 @@
+#include "Profiler.h"
+#include "Helper.h"
+#include <algorithm>
+#include <cstdint>
+#include <fstream>
+#include <iomanip>
+
+using namespace std;
+using namespace Helper;
+
+// Several seconds worth of frames
+const size_t Profiler::zonesPerThread{1 << 16};
+
+vector<Profiler::ThreadRing *> Profiler::rings;
+
+// Guards the list of rings. Never destroyed, as threads may record until the program exits
+static SDL_mutex *GetRingsMutex()
+{
+  static SDL_mutex *ringsMutex = SDL_CreateMutex();
+
+  return ringsMutex;
+}
+
+Profiler::ThreadRing &Profiler::GetThreadRing()
+{
+  thread_local ThreadRing *ring{nullptr};
+
+  if (ring != nullptr)
+    return *ring;
+
+  SDL_LockMutex(GetRingsMutex());
+
+  ring = new ThreadRing();
+  ring->id = int(rings.size());
+  ring->name = "Thread " + to_string(ring->id);
+  ring->zones.resize(zonesPerThread);
+  ring->mutex = SDL_CreateMutex();
+
+  rings.push_back(ring);
+
+  SDL_UnlockMutex(GetRingsMutex());
+
+  return *ring;
+}
+
+void Profiler::Record(const char *name, Uint64 start, Uint64 end)
+{
+  auto &ring = GetThreadRing();
+
+  SDL_LockMutex(ring.mutex);
+
+  ring.zones[ring.next] = Zone{name, start, end};
+  ring.next = (ring.next + 1) % ring.zones.size();
+  ring.count = min(ring.count + 1, ring.zones.size());
+
+  SDL_UnlockMutex(ring.mutex);
+}
+
+void Profiler::SetThreadName(string name)
+{
+  auto &ring = GetThreadRing();
+
+  SDL_LockMutex(ring.mutex);
+  ring.name = name;
+  SDL_UnlockMutex(ring.mutex);
+}
+
+// Escapes a string for JSON
+static string Escape(const string &text)
+{
+  string escaped;
+
+  for (char character : text)
+  {
+    if (character == '"' || character == '\\')
+      escaped += '\\';
+
+    escaped += character;
+  }
+
+  return escaped;
+}
+
+bool Profiler::ExportTrace(string path)
+{
+  ofstream output(path);
+
+  if (output.is_open() == false)
+    return false;
+
+  // Timestamps are microseconds, from the earliest kept zone
+  auto toMicroseconds = [](Uint64 ticks)
+  { return Clock::ToMilliseconds(ticks) * 1000; };
+
+  SDL_LockMutex(GetRingsMutex());
+
+  // A copy of a ring
+  struct Snapshot
+  {
+    string name;
+    int id;
+    vector<Zone> zones;
+  };
+
+  // Copy each ring, so threads are only held up for the copy
+  vector<Snapshot> snapshots;
+  Uint64 origin{UINT64_MAX};
+
+  for (auto ring : rings)
+  {
+    SDL_LockMutex(ring->mutex);
+
+    Snapshot snapshot{ring->name, ring->id, {}};
+    snapshot.zones.reserve(ring->count);
+
+    // Oldest first
+    for (size_t index{0}; index < ring->count; index++)
+      snapshot.zones.push_back(ring->zones[(ring->next + ring->zones.size() - ring->count + index) % ring->zones.size()]);
+
+    SDL_UnlockMutex(ring->mutex);
+
+    // Zones are recorded as they end, so an enclosing zone comes after the zones it started before
+    for (auto &zone : snapshot.zones)
+      origin = min(origin, zone.start);
+
+    snapshots.push_back(move(snapshot));
+  }
+
+  SDL_UnlockMutex(GetRingsMutex());
+
+  output << fixed << setprecision(3) << "{\"traceEvents\":[";
+
+  bool first{true};
+  size_t zoneCount{0};
+
+  for (auto &snapshot : snapshots)
+  {
+    output << (first ? "" : ",") << "\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << snapshot.id
+           << ",\"args\":{\"name\":\"" << Escape(snapshot.name) << "\"}}";
+    first = false;
+
+    for (auto &zone : snapshot.zones)
+      output << ",\n{\"name\":\"" << Escape(zone.name) << "\",\"ph\":\"X\",\"pid\":1,\"tid\":" << snapshot.id
+             << ",\"ts\":" << toMicroseconds(zone.start - origin) << ",\"dur\":" << toMicroseconds(zone.end - zone.start) << "}";
+
+    zoneCount += snapshot.zones.size();
+  }
+
+  output << "\n]}\n";
+
+  MESSAGE << "Exported " << zoneCount << " profiler zones to " << path << endl;
+
+  return output.good();
+}
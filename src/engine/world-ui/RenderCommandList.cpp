@@ -0,0 +1,139 @@
+#include "RenderCommandList.h"
+
+using namespace std;
+
+void RenderCommandList::Target(const shared_ptr<SDL_Texture> &texture)
+{
+  Command command;
+  command.type = CommandType::Target;
+  command.texture = KeepTexture(texture);
+
+  commands.push_back(command);
+}
+
+void RenderCommandList::Clear(Color color)
+{
+  Command command;
+  command.type = CommandType::Clear;
+  command.color = color;
+
+  commands.push_back(command);
+}
+
+void RenderCommandList::Geometry(const shared_ptr<SDL_Texture> &texture, const vector<SDL_Vertex> &newVertices, const vector<int> &newIndices)
+{
+  Command command;
+  command.type = CommandType::Geometry;
+  command.first = int(vertices.size());
+  command.count = int(newVertices.size());
+  command.firstIndex = int(indices.size());
+  command.indexCount = int(newIndices.size());
+
+  command.texture = KeepTexture(texture);
+
+  vertices.insert(vertices.end(), newVertices.begin(), newVertices.end());
+  indices.insert(indices.end(), newIndices.begin(), newIndices.end());
+
+  commands.push_back(command);
+}
+
+int RenderCommandList::KeepTexture(const shared_ptr<SDL_Texture> &texture)
+{
+  if (texture == nullptr)
+    return -1;
+
+  // Consecutive commands often share a texture
+  if (textures.empty() || textures.back() != texture)
+    textures.push_back(texture);
+
+  return int(textures.size()) - 1;
+}
+
+void RenderCommandList::Points(Color color, const vector<SDL_FPoint> &newPoints)
+{
+  Command command;
+  command.type = CommandType::Points;
+  command.color = color;
+  command.first = int(points.size());
+  command.count = int(newPoints.size());
+
+  points.insert(points.end(), newPoints.begin(), newPoints.end());
+
+  commands.push_back(command);
+}
+
+void RenderCommandList::LineStrips(Color color, const vector<SDL_FPoint> &newPoints, const vector<int> &newStripLengths)
+{
+  Command command;
+  command.type = CommandType::LineStrips;
+  command.color = color;
+  command.first = int(points.size());
+  command.count = int(newPoints.size());
+  command.firstIndex = int(stripLengths.size());
+  command.indexCount = int(newStripLengths.size());
+
+  points.insert(points.end(), newPoints.begin(), newPoints.end());
+  stripLengths.insert(stripLengths.end(), newStripLengths.begin(), newStripLengths.end());
+
+  commands.push_back(command);
+}
+
+void RenderCommandList::Execute(SDL_Renderer *renderer, RenderContext &context) const
+{
+  for (auto &command : commands)
+  {
+    auto texture = command.texture >= 0 ? textures[command.texture].get() : nullptr;
+
+    switch (command.type)
+    {
+    case CommandType::Target:
+      context.SetTarget(texture);
+      break;
+
+    case CommandType::Clear:
+      context.SetDrawColor(command.color);
+      SDL_RenderClear(renderer);
+      break;
+
+    case CommandType::Geometry:
+    {
+      // Solid quads follow the renderer's draw blend mode, so make sure they blend like textures do
+      if (texture == nullptr)
+        context.SetDrawBlendMode(SDL_BLENDMODE_BLEND);
+
+      SDL_RenderGeometry(renderer, texture, vertices.data() + command.first, command.count,
+                         indices.data() + command.firstIndex, command.indexCount);
+      break;
+    }
+
+    case CommandType::Points:
+      context.SetDrawColor(command.color);
+      SDL_RenderDrawPointsF(renderer, points.data() + command.first, command.count);
+      break;
+
+    case CommandType::LineStrips:
+    {
+      context.SetDrawColor(command.color);
+
+      auto strip = points.data() + command.first;
+
+      for (int index{command.firstIndex}; index < command.firstIndex + command.indexCount; index++)
+      {
+        SDL_RenderDrawLinesF(renderer, strip, stripLengths[index]);
+        strip += stripLengths[index];
+      }
+      break;
+    }
+    }
+  }
+}
+
+void RenderCommandList::Reset()
+{
+  commands.clear();
+  vertices.clear();
+  indices.clear();
+  points.clear();
+  stripLengths.clear();
+  textures.clear();
+}
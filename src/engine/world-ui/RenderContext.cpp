@@ -0,0 +1,79 @@
+#include "RenderContext.h"
+#include "Game.h"
+
+using namespace std;
+
+void RenderContext::SetDrawColor(Color color)
+{
+  if (Count(drawColor.Update(color)))
+    SDL_SetRenderDrawColor(Game::GetInstance().GetRenderer(), color.red, color.green, color.blue, color.alpha);
+}
+
+void RenderContext::SetDrawBlendMode(SDL_BlendMode blendMode)
+{
+  if (Count(drawBlendMode.Update(blendMode)))
+    SDL_SetRenderDrawBlendMode(Game::GetInstance().GetRenderer(), blendMode);
+}
+
+void RenderContext::SetTarget(SDL_Texture *newTarget)
+{
+  if (Count(target.Update(newTarget)))
+    SDL_SetRenderTarget(Game::GetInstance().GetRenderer(), newTarget);
+}
+
+void RenderContext::SetTextureColorMod(const shared_ptr<SDL_Texture> &texture, Color color)
+{
+  auto &state = GetState(texture);
+
+  if (Count(state.colorMod.Update(color)))
+  {
+    SDL_SetTextureColorMod(texture.get(), color.red, color.green, color.blue);
+    SDL_SetTextureAlphaMod(texture.get(), color.alpha);
+  }
+}
+
+void RenderContext::SetTextureBlendMode(const shared_ptr<SDL_Texture> &texture, SDL_BlendMode blendMode)
+{
+  if (Count(GetState(texture).blendMode.Update(blendMode)))
+    SDL_SetTextureBlendMode(texture.get(), blendMode);
+}
+
+RenderContext::TextureState &RenderContext::GetState(const shared_ptr<SDL_Texture> &texture)
+{
+  auto &state = textureStates[texture.get()];
+
+  // A different texture (or none) was known by this address
+  if (state.weakTexture.lock() != texture)
+    state = TextureState{texture, {}, {}};
+
+  return state;
+}
+
+bool RenderContext::Count(bool changed)
+{
+  stats.requested++;
+
+  if (changed)
+    stats.applied++;
+
+  return changed;
+}
+
+RenderContext::Stats RenderContext::EndFrame()
+{
+  // Forget destroyed textures
+  for (auto stateIterator = textureStates.begin(); stateIterator != textureStates.end();)
+  {
+    if (stateIterator->second.weakTexture.expired())
+      stateIterator = textureStates.erase(stateIterator);
+    else
+      stateIterator++;
+  }
+
+  auto frameStats = stats;
+  stats = Stats();
+
+  return frameStats;
+}
+
+RenderContext::Stats RenderContext::GetStats() const { return stats; }
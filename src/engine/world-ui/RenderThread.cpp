@@ -0,0 +1,169 @@
+#include "RenderThread.h"
+#include "Helper.h"
+#include "Profiler.h"
+
+using namespace std;
+using namespace Helper;
+
+// Never destroyed, as textures may still be released during program exit
+static SDL_mutex *GetRendererMutex()
+{
+  static SDL_mutex *rendererMutex = SDL_CreateMutex();
+
+  return rendererMutex;
+}
+
+RendererLock::RendererLock() { SDL_LockMutex(GetRendererMutex()); }
+
+RendererLock::~RendererLock() { SDL_UnlockMutex(GetRendererMutex()); }
+
+RenderThread::RenderThread(SDL_Renderer *renderer, RenderContext &context, bool threaded)
+    : renderer(renderer), context(context)
+{
+  Assert(GetRendererMutex() != nullptr, "Failed to create renderer mutex");
+
+  if (threaded == false)
+    return;
+
+  mutex = SDL_CreateMutex();
+  condition = SDL_CreateCond();
+
+  Assert(mutex != nullptr && condition != nullptr, "Failed to create render thread synchronization");
+
+  thread = SDL_CreateThread(Run, "Render", this);
+
+  Assert(thread != nullptr, "Failed to create render thread");
+}
+
+RenderThread::~RenderThread()
+{
+  if (thread == nullptr)
+    return;
+
+  // Let it present what's left, then stop
+  SDL_LockMutex(mutex);
+  stopRequested = true;
+  SDL_CondBroadcast(condition);
+  SDL_UnlockMutex(mutex);
+
+  SDL_WaitThread(thread, nullptr);
+
+  SDL_DestroyCond(condition);
+  SDL_DestroyMutex(mutex);
+}
+
+void RenderThread::Submit()
+{
+  if (thread == nullptr)
+  {
+    Present(*recording);
+    return;
+  }
+
+  SDL_LockMutex(mutex);
+
+  // Wait for the previous frame, whose list is the one we'll record into next
+  while (submitted != nullptr)
+    SDL_CondWait(condition, mutex);
+
+  submitted = recording;
+  recording = recording == &lists[0] ? &lists[1] : &lists[0];
+
+  SDL_CondBroadcast(condition);
+  SDL_UnlockMutex(mutex);
+}
+
+void RenderThread::Finish()
+{
+  if (thread == nullptr)
+    return;
+
+  SDL_LockMutex(mutex);
+
+  while (submitted != nullptr)
+    SDL_CondWait(condition, mutex);
+
+  SDL_UnlockMutex(mutex);
+}
+
+RenderContext::Stats RenderThread::GetLastContextStats()
+{
+  if (thread == nullptr)
+    return lastContextStats;
+
+  SDL_LockMutex(mutex);
+  auto stats = lastContextStats;
+  SDL_UnlockMutex(mutex);
+
+  return stats;
+}
+
+void RenderThread::DestroyTexture(SDL_Texture *texture)
+{
+  RendererLock lock;
+
+  SDL_DestroyTexture(texture);
+}
+
+int RenderThread::Run(void *renderThreadPointer)
+{
+  auto &renderThread = *static_cast<RenderThread *>(renderThreadPointer);
+
+#ifdef PROFILE_FRAMES
+  Profiler::SetThreadName("Render");
+#endif
+
+  SDL_LockMutex(renderThread.mutex);
+
+  while (true)
+  {
+    while (renderThread.submitted == nullptr && renderThread.stopRequested == false)
+      SDL_CondWait(renderThread.condition, renderThread.mutex);
+
+    // Only stop once there's nothing left to present
+    if (renderThread.submitted == nullptr)
+      break;
+
+    auto &list = *renderThread.submitted;
+
+    // Let the simulation carry on while this frame is presented
+    SDL_UnlockMutex(renderThread.mutex);
+    renderThread.Present(list);
+    SDL_LockMutex(renderThread.mutex);
+
+    renderThread.submitted = nullptr;
+    SDL_CondBroadcast(renderThread.condition);
+  }
+
+  SDL_UnlockMutex(renderThread.mutex);
+
+  return 0;
+}
+
+void RenderThread::Present(RenderCommandList &list)
+{
+  PROFILE_ZONE("RenderThread::Present");
+
+  RenderContext::Stats frameStats;
+
+  {
+    RendererLock lock;
+
+    list.Execute(renderer, context);
+
+    SDL_RenderPresent(renderer);
+
+    frameStats = context.EndFrame();
+  }
+
+  // Release the frame's textures
+  list.Reset();
+
+  if (thread != nullptr)
+    SDL_LockMutex(mutex);
+
+  lastContextStats = frameStats;
+
+  if (thread != nullptr)
+    SDL_UnlockMutex(mutex);
+}
@@ -0,0 +1,7 @@
+#include "Renderable.h"
+
+HandleTable<Renderable> Renderable::handleTable;
+
+Renderable::Renderable() : renderHandle(handleTable.Insert(this)) {}
+
+Renderable::~Renderable() { handleTable.Remove(renderHandle); }
@@ -1,35 +1,68 @@
 #include "Game.h"
 #include "Resources.h"
 #include "Helper.h"
+#include "AssetArchive.h"
 #include <utility>
 #include <tuple>
 #include <memory>
+#include <algorithm>
 
 using namespace std;
 using namespace Helper;
 
-Resources::table<SDL_Texture> Resources::textureTable;
+Resources::table<TextureAtlas::Region> Resources::imageTable{"image"};
 
-Resources::table<Sprite> Resources::spriteTable;
+TextureAtlas Resources::atlas;
 
-Resources::table<Mix_Music> Resources::musicTable;
+Resources::table<Sprite> Resources::spriteTable{"sprite"};
 
-Resources::table<Mix_Chunk> Resources::soundTable;
+Resources::table<Mix_Music> Resources::musicTable{"music"};
 
-Resources::table<TTF_Font> Resources::fontTable;
+Resources::table<Mix_Chunk> Resources::soundTable{"sound"};
 
-shared_ptr<SDL_Texture> Resources::GetTexture(string filename)
+Resources::table<TTF_Font> Resources::fontTable{"font"};
+
+Resources::table<GlyphAtlas> Resources::glyphAtlasTable{"glyph atlas"};
+
+unordered_map<string, shared_ptr<AssetRequest>> Resources::pendingRequests;
+
+deque<shared_ptr<AssetRequest>> Resources::uploadQueue;
+
+AssetManifest Resources::recordedAssets;
+
+unsigned long Resources::useCounter{0};
+
+size_t Resources::memoryBudget{128 << 20};
+
+// A 1024x1024 image
+const size_t Resources::uploadBudget{4 << 20};
+
+shared_ptr<TextureAtlas::Region> Resources::GetImage(string filename) { return GetImage(InternImage(filename)); }
+
+shared_ptr<TextureAtlas::Region> Resources::GetImage(ImageHandle image)
 {
-  function<SDL_Texture *(string)> textureLoader = [](string filename)
+  if (auto loaded = GetLoaded(imageTable, image.index, recordedAssets.images))
+    return loaded;
+
+  function<TextureAtlas::Region *(string)> imageLoader = [](string filename) -> TextureAtlas::Region *
   {
-    // Get the game renderer
-    SDL_Renderer *renderer = Game::GetInstance().GetRenderer();
+    // Load the pixels
+    auto_unique_ptr<SDL_Surface> surface(AssetArchive::LoadSurface(filename), SDL_FreeSurface);
+
+    if (surface == nullptr)
+      return nullptr;
 
-    // Gets the texture pointer
-    return IMG_LoadTexture(renderer, filename.c_str());
+    // Pack them
+    return new TextureAtlas::Region(atlas.Pack(surface.get()));
   };
 
-  return GetResource<SDL_Texture>("texture", filename, textureTable, textureLoader, SDL_DestroyTexture);
+  // Its destructor
+  void (*imageDestructor)(TextureAtlas::Region *) = [](TextureAtlas::Region *region)
+  { delete region; };
+
+  AwaitPending(AssetRequest::Type::Image, imageTable.entries[image.index].key);
+
+  return GetResource<TextureAtlas::Region>("image", image.index, imageTable, imageLoader, imageDestructor);
 }
 
 shared_ptr<Sprite> Resources::GetSprite(string filename, SDL_Rect clipRect)
@@ -49,8 +82,11 @@ shared_ptr<Sprite> Resources::GetSprite(string filename, SDL_Rect clipRect)
   void (*spriteDestructor)(Sprite *) = [](Sprite *sprite)
   { delete sprite; };
 
-  // Its store key
-  string storeKey = filename + (string)Rectangle(clipRect);
+  recordedAssets.sprites.insert(AssetManifest::SpriteClip{filename, clipRect});
+
+  // Its store key, from the clip's integers (formatting them as a Rectangle's floats is much slower)
+  string storeKey = filename + "@" + to_string(clipRect.x) + "," + to_string(clipRect.y) + "," +
+                    to_string(clipRect.w) + "," + to_string(clipRect.h);
 
   return GetResource<Sprite>("sprite", storeKey, spriteTable, spriteLoader, spriteDestructor, filename);
 }
@@ -64,24 +100,38 @@ shared_ptr<Sprite> Resources::GetSprite(string filename, SpriteConfig config, SD
   return sprite;
 }
 
-shared_ptr<Mix_Music> Resources::GetMusic(string filename)
+shared_ptr<Mix_Music> Resources::GetMusic(string filename) { return GetMusic(InternMusic(filename)); }
+
+shared_ptr<Mix_Music> Resources::GetMusic(MusicHandle music)
 {
+  if (auto loaded = GetLoaded(musicTable, music.index, recordedAssets.music))
+    return loaded;
+
   function<Mix_Music *(string)> musicLoader = [](string filename)
   {
-    return Mix_LoadMUS(filename.c_str());
+    return Mix_LoadMUS_RW(AssetArchive::OpenStream(filename), 1);
   };
 
-  return GetResource<Mix_Music>("music", filename, musicTable, musicLoader, Mix_FreeMusic);
+  AwaitPending(AssetRequest::Type::Music, musicTable.entries[music.index].key);
+
+  return GetResource<Mix_Music>("music", music.index, musicTable, musicLoader, Mix_FreeMusic);
 }
 
-shared_ptr<Mix_Chunk> Resources::GetSound(string filename)
+shared_ptr<Mix_Chunk> Resources::GetSound(string filename) { return GetSound(InternSound(filename)); }
+
+shared_ptr<Mix_Chunk> Resources::GetSound(SoundHandle sound)
 {
+  if (auto loaded = GetLoaded(soundTable, sound.index, recordedAssets.sounds))
+    return loaded;
+
   function<Mix_Chunk *(string)> chunkLoader = [](string filename)
   {
-    return Mix_LoadWAV(filename.c_str());
+    return Mix_LoadWAV_RW(AssetArchive::OpenStream(filename), 1);
   };
 
-  return GetResource<Mix_Chunk>("sound chunk", filename, soundTable, chunkLoader, Mix_FreeChunk);
+  AwaitPending(AssetRequest::Type::Sound, soundTable.entries[sound.index].key);
+
+  return GetResource<Mix_Chunk>("sound chunk", sound.index, soundTable, chunkLoader, Mix_FreeChunk);
 }
 
 shared_ptr<TTF_Font> Resources::GetFont(string filename, int size)
@@ -97,11 +147,226 @@ shared_ptr<TTF_Font> Resources::GetFont(string filename, int size)
     // Get the file name
     string filename = string(fontKey, delimiter + 1);
 
-    return TTF_OpenFont(filename.c_str(), size);
+    return TTF_OpenFontRW(AssetArchive::OpenStream(filename), 1, size);
   };
 
+  recordedAssets.fonts.emplace(filename, size);
+
   // Build the table key
   string fontKey = to_string(size) + "$" + filename;
 
   return GetResource<TTF_Font>("font", fontKey, fontTable, fontLoader, TTF_CloseFont);
 }
+
+shared_ptr<GlyphAtlas> Resources::GetGlyphAtlas(string filename, int size)
+{
+  function<GlyphAtlas *(string)> glyphAtlasLoader = [filename, size](string)
+  {
+    return new GlyphAtlas(GetFont(filename, size), atlas);
+  };
+
+  // Its destructor
+  void (*glyphAtlasDestructor)(GlyphAtlas *) = [](GlyphAtlas *glyphAtlas)
+  { delete glyphAtlas; };
+
+  recordedAssets.fonts.emplace(filename, size);
+
+  // Same key as the font's
+  string glyphAtlasKey = to_string(size) + "$" + filename;
+
+  return GetResource<GlyphAtlas>("glyph atlas", glyphAtlasKey, glyphAtlasTable, glyphAtlasLoader, glyphAtlasDestructor);
+}
+
+// === BACKGROUND LOADING
+
+template <class Resource>
+shared_ptr<AssetRequest> Resources::LoadAsync(AssetRequest::Type type, string filename, table<Resource> &table)
+{
+  auto request = make_shared<AssetRequest>(type, filename);
+
+  // Already loaded
+  if (auto &entry = table.entries[Intern(table, filename)]; entry.resource != nullptr)
+  {
+    table.stats.hits++;
+    entry.lastUse = useCounter++;
+
+    request->state = AssetRequest::State::Ready;
+    return request;
+  }
+
+  // Already being loaded
+  auto key = GetRequestKey(type, filename);
+
+  if (auto pending = pendingRequests.find(key); pending != pendingRequests.end())
+    return pending->second;
+
+  pendingRequests[key] = request;
+
+  Game::GetInstance().GetAssetLoader().Enqueue(request);
+
+  return request;
+}
+
+shared_ptr<AssetRequest> Resources::LoadImageAsync(string filename)
+{
+  return LoadAsync(AssetRequest::Type::Image, filename, imageTable);
+}
+
+shared_ptr<AssetRequest> Resources::LoadSoundAsync(string filename)
+{
+  return LoadAsync(AssetRequest::Type::Sound, filename, soundTable);
+}
+
+shared_ptr<AssetRequest> Resources::LoadMusicAsync(string filename)
+{
+  return LoadAsync(AssetRequest::Type::Music, filename, musicTable);
+}
+
+void Resources::CompleteLoads()
+{
+  PROFILE_ZONE("Resources::CompleteLoads");
+
+  auto &loader = Game::GetInstance().GetAssetLoader();
+
+  while (auto request = loader.TakeDecoded())
+    uploadQueue.push_back(request);
+
+  size_t uploaded{0};
+
+  // Audio costs no upload, and at least one image is always uploaded
+  while (uploadQueue.empty() == false && uploaded < uploadBudget)
+  {
+    auto request = uploadQueue.front();
+    uploadQueue.pop_front();
+
+    // It may have been awaited already
+    if (request->IsReady())
+      continue;
+
+    uploaded += request->GetUploadSize();
+
+    Store(request);
+  }
+}
+
+void Resources::AwaitPending(AssetRequest::Type type, string filename)
+{
+  if (pendingRequests.empty())
+    return;
+
+  auto pending = pendingRequests.find(GetRequestKey(type, filename));
+
+  if (pending == pendingRequests.end())
+    return;
+
+  auto request = pending->second;
+
+  Game::GetInstance().GetAssetLoader().Wait(request);
+
+  Store(request);
+}
+
+void Resources::Store(const shared_ptr<AssetRequest> &request)
+{
+  PROFILE_ZONE("Resources::Store");
+
+  // Unless the asset was requested again after this request failed
+  auto pending = pendingRequests.find(GetRequestKey(request->type, request->filename));
+
+  if (pending != pendingRequests.end() && pending->second == request)
+    pendingRequests.erase(pending);
+
+  // A failed request is left out of the tables, so getting it reports the error
+  if (request->state != AssetRequest::State::Decoded)
+    return;
+
+  switch (request->type)
+  {
+  case AssetRequest::Type::Image:
+    Insert(imageTable, Intern(imageTable, request->filename), make_shared<TextureAtlas::Region>(atlas.Pack(request->surface)));
+
+    SDL_FreeSurface(request->surface);
+    request->surface = nullptr;
+    break;
+
+  case AssetRequest::Type::Sound:
+    Insert(soundTable, Intern(soundTable, request->filename), shared_ptr<Mix_Chunk>(request->chunk, Mix_FreeChunk));
+    request->chunk = nullptr;
+    break;
+
+  case AssetRequest::Type::Music:
+    Insert(musicTable, Intern(musicTable, request->filename), shared_ptr<Mix_Music>(request->music, Mix_FreeMusic));
+    request->music = nullptr;
+    break;
+  }
+
+  request->state = AssetRequest::State::Ready;
+}
+
+// === MANIFEST RECORDING
+
+void Resources::ResetRecordedAssets()
+{
+  recordedAssets.Clear();
+
+  // Entries which are got through handles remember whether they were recorded
+  for (auto &entry : imageTable.entries)
+    entry.recorded = false;
+
+  for (auto &entry : soundTable.entries)
+    entry.recorded = false;
+
+  for (auto &entry : musicTable.entries)
+    entry.recorded = false;
+}
+
+// === CACHE
+
+void Resources::Trim(size_t budget)
+{
+  PROFILE_ZONE("Resources::Trim");
+
+  // A zero budget also evicts resources whose memory isn't measured
+  while (GetResidentBytes() > budget || budget == 0)
+  {
+    // Find the least recently used resource nothing else holds, in any table
+    auto oldest = min({GetOldestUnused(spriteTable), GetOldestUnused(glyphAtlasTable), GetOldestUnused(imageTable),
+                       GetOldestUnused(soundTable), GetOldestUnused(musicTable), GetOldestUnused(fontTable)});
+
+    if (oldest == ULONG_MAX)
+      break;
+
+    // Sprites & glyph atlases hold images & fonts, which may only become evictable once they are gone
+    Evict(spriteTable, oldest) || Evict(glyphAtlasTable, oldest) || Evict(imageTable, oldest) ||
+        Evict(soundTable, oldest) || Evict(musicTable, oldest) || Evict(fontTable, oldest);
+
+    // An evicted image only frees memory once the last image of it's atlas page is gone
+    atlas.ReleaseUnusedPages();
+  }
+
+#ifdef PRINT_RESOURCE_STATS
+  for (auto &[type, stats] : GetStats())
+    MESSAGE << "Resources: " << type << " cache had " << stats.hits << " hits, " << stats.misses << " misses, "
+            << stats.evictions << " evictions, " << stats.residentBytes / 1024 << " KiB resident" << endl;
+
+  MESSAGE << "Resources: atlas has " << atlas.PageCount() << " pages, " << atlas.GetResidentBytes() / 1024
+          << " KiB resident" << endl;
+#endif
+}
+
+size_t Resources::GetResidentBytes()
+{
+  return imageTable.stats.residentBytes + spriteTable.stats.residentBytes + musicTable.stats.residentBytes +
+         soundTable.stats.residentBytes + fontTable.stats.residentBytes + glyphAtlasTable.stats.residentBytes +
+         atlas.GetResidentBytes();
+}
+
+vector<pair<string, Resources::CacheStats>> Resources::GetStats()
+{
+  return {{imageTable.name, imageTable.stats},
+          {spriteTable.name, spriteTable.stats},
+          {musicTable.name, musicTable.stats},
+          {soundTable.name, soundTable.stats},
+          {fontTable.name, fontTable.stats},
+          {glyphAtlasTable.name, glyphAtlasTable.stats}};
+}
@@ -0,0 +1,146 @@
+#include <algorithm>
+#include "Scheduler.h"
+#include "GameObject.h"
+
+using namespace std;
+using namespace Helper;
+
+int Scheduler::Schedule(function<void()> procedure, float seconds, Handle owner)
+{
+  Entry entry{time + seconds, time + seconds, owner, nextToken++};
+
+  // Follow the owner's clock
+  if (owner)
+  {
+    auto ownerObject = GameObject::Resolve(owner);
+
+    Assert(ownerObject != nullptr, "Tried to schedule a procedure for an object which no longer exists");
+
+    entry.ownerDueTime = ownerObject->GetSimulationTime() + seconds;
+    Estimate(entry);
+  }
+
+  procedures[entry.token] = procedure;
+
+  // Don't touch the heap while it's being consumed
+  if (updating)
+    deferredEntries.push_back(entry);
+  else
+    Push(entry);
+
+  return entry.token;
+}
+
+void Scheduler::Cancel(int token) { procedures.erase(token); }
+
+bool Scheduler::IsPending(int token) const { return procedures.count(token) > 0; }
+
+void Scheduler::Update(float deltaTime)
+{
+  time += deltaTime;
+
+  updating = true;
+
+  while (heap.empty() == false && heap.front().dueTime <= time)
+  {
+    pop_heap(heap.begin(), heap.end(), IsLater);
+    auto entry = heap.back();
+    heap.pop_back();
+
+    // Skip canceled entries
+    auto procedureIterator = procedures.find(entry.token);
+    if (procedureIterator == procedures.end())
+      continue;
+
+    // Discard it if the owner is gone
+    if (Estimate(entry) == false)
+    {
+      procedures.erase(procedureIterator);
+      continue;
+    }
+
+    // If the owner's time flowed slower than expected, it's not due yet
+    if (entry.dueTime > time)
+    {
+      Push(entry);
+      continue;
+    }
+
+    // Forget it before executing, as the procedure may schedule or cancel others
+    auto procedure = procedureIterator->second;
+    procedures.erase(procedureIterator);
+
+    procedure();
+  }
+
+  updating = false;
+
+  // Add entries scheduled during the update
+  for (auto &entry : deferredEntries)
+    Push(entry);
+
+  deferredEntries.clear();
+}
+
+void Scheduler::Retime()
+{
+  auto retime = [this](vector<Entry> &entries)
+  {
+    auto entryIterator = entries.begin();
+    while (entryIterator != entries.end())
+    {
+      // Drop entries which were canceled or lost their owner
+      if (procedures.count(entryIterator->token) == 0 || Estimate(*entryIterator) == false)
+      {
+        procedures.erase(entryIterator->token);
+        entryIterator = entries.erase(entryIterator);
+      }
+      else
+        entryIterator++;
+    }
+  };
+
+  retime(heap);
+  retime(deferredEntries);
+
+  make_heap(heap.begin(), heap.end(), IsLater);
+}
+
+bool Scheduler::Estimate(Entry &entry) const
+{
+  // Scene time entries are always exact
+  if (entry.owner.IsNull())
+  {
+    entry.dueTime = entry.ownerDueTime;
+    return true;
+  }
+
+  auto owner = GameObject::Resolve(entry.owner);
+
+  if (owner == nullptr)
+    return false;
+
+  double remaining = max(entry.ownerDueTime - owner->GetSimulationTime(), 0.0);
+
+  entry.dueTime = time + remaining / owner->GetTimeScale();
+
+  return true;
+}
+
+void Scheduler::Push(const Entry &entry)
+{
+  heap.push_back(entry);
+  push_heap(heap.begin(), heap.end(), IsLater);
+}
+
+bool Scheduler::IsLater(const Entry &first, const Entry &second)
+{
+  if (first.dueTime != second.dueTime)
+    return first.dueTime > second.dueTime;
+
+  return first.token > second.token;
+}
+
+double Scheduler::GetTime() const { return time; }
+
+size_t Scheduler::Count() const { return procedures.size(); }
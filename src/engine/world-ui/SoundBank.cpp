@@ -0,0 +1,58 @@
+#include "SoundBank.h"
+
+using namespace std;
+using namespace Helper;
+
+vector<SoundBank::Sample> SoundBank::samples;
+
+unordered_map<string, int> SoundBank::ids;
+
+int SoundBank::Register(string path, SoundCategory category, int priority)
+{
+  auto [idIterator, isNew] = ids.emplace(path, int(samples.size()));
+
+  if (isNew)
+    samples.push_back(Sample{path, Resources::InternSound(path), category, priority, nullptr});
+
+  // Decode it in the background, so the first play doesn't hitch
+  if (samples[idIterator->second].chunk == nullptr)
+    Resources::LoadSoundAsync(path);
+
+  return idIterator->second;
+}
+
+const SoundBank::Sample &SoundBank::GetSample(int id)
+{
+  Assert(id >= 0 && id < int(samples.size()), "Invalid sample id " + to_string(id));
+
+  return samples[id];
+}
+
+Mix_Chunk *SoundBank::GetChunk(int id)
+{
+  Assert(id >= 0 && id < int(samples.size()), "Invalid sample id " + to_string(id));
+
+  auto &sample = samples[id];
+
+  if (sample.chunk == nullptr)
+    sample.chunk = Resources::GetSound(sample.handle);
+
+  return sample.chunk.get();
+}
+
+void SoundBank::Release()
+{
+  for (auto &sample : samples)
+    sample.chunk = nullptr;
+}
+
+size_t SoundBank::GetResidentBytes()
+{
+  size_t bytes{0};
+
+  for (auto &sample : samples)
+    if (sample.chunk != nullptr)
+      bytes += sample.chunk->alen;
+
+  return bytes;
+}
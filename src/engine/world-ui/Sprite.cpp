@@ -10,17 +10,22 @@ Sprite::Sprite(const string initialTexture, SpriteConfig config) : config(config
 
 void Sprite::Load(const string fileName)
 {
-  // Get texture from resource manager
-  texture = Resources::GetTexture(fileName);
+  // Get image from resource manager
+  image = Resources::GetImage(fileName);
 
   // Get it's dimensions
-  SDL_QueryTexture(texture.get(), nullptr, nullptr, &width, &height);
+  width = image->rect.w;
+  height = image->rect.h;
 
   // Set the clip to the full image
   SetClip(SDL_Rect{0, 0, width, height});
 }
 
-SDL_Rect Sprite::GetClip() const { return clipRect; }
+SDL_Rect Sprite::GetClip() const
+{
+  // Offset it to where the image is in it's texture
+  return SDL_Rect{clipRect.x + image->rect.x, clipRect.y + image->rect.y, clipRect.w, clipRect.h};
+}
 
 void Sprite::SetClip(SDL_Rect rect)
 {
@@ -69,4 +74,4 @@ float Sprite::GetHeight(float scale) const
 
 void Sprite::SetConfig(SpriteConfig newConfig) { config = newConfig; }
 
-std::shared_ptr<SDL_Texture> Sprite::GetTexture() const { return texture; }
+std::shared_ptr<SDL_Texture> Sprite::GetTexture() const { return image->texture; }
@@ -0,0 +1,95 @@
+#include <cmath>
+#include "SpriteBatch.h"
+#include "Game.h"
+
+using namespace std;
+
+void SpriteBatch::Draw(const shared_ptr<SDL_Texture> &texture, const SDL_Rect &source, const SDL_FRect &destination,
+                       Color color, double angle, SDL_RendererFlip flip)
+{
+  // Switching textures ends the current batch
+  if (texture != batchTexture)
+  {
+    Flush();
+
+    batchTexture = texture;
+    SDL_QueryTexture(texture.get(), nullptr, nullptr, &textureWidth, &textureHeight);
+  }
+
+  // Normalize clip
+  SDL_FPoint uvMin{float(source.x) / textureWidth, float(source.y) / textureHeight};
+  SDL_FPoint uvMax{float(source.x + source.w) / textureWidth, float(source.y + source.h) / textureHeight};
+
+  // Flipping is just swapping coordinates
+  if (flip & SDL_FLIP_HORIZONTAL)
+    swap(uvMin.x, uvMax.x);
+
+  if (flip & SDL_FLIP_VERTICAL)
+    swap(uvMin.y, uvMax.y);
+
+  Push(texture, destination, uvMin, uvMax, color, angle);
+}
+
+void SpriteBatch::Fill(const SDL_FRect &destination, Color color)
+{
+  Push(nullptr, destination, {0, 0}, {0, 0}, color, 0);
+}
+
+void SpriteBatch::Push(const shared_ptr<SDL_Texture> &texture, const SDL_FRect &destination, SDL_FPoint uvMin, SDL_FPoint uvMax, SDL_Color color, double angle)
+{
+  if (texture != batchTexture)
+  {
+    Flush();
+    batchTexture = texture;
+  }
+
+  stats.quads++;
+
+  // Corners relative to the center
+  float halfWidth = destination.w / 2, halfHeight = destination.h / 2;
+  SDL_FPoint center{destination.x + halfWidth + offset.x, destination.y + halfHeight + offset.y};
+
+  SDL_FPoint corners[]{{-halfWidth, -halfHeight}, {halfWidth, -halfHeight}, {halfWidth, halfHeight}, {-halfWidth, halfHeight}};
+  SDL_FPoint coordinates[]{{uvMin.x, uvMin.y}, {uvMax.x, uvMin.y}, {uvMax.x, uvMax.y}, {uvMin.x, uvMax.y}};
+
+  // Screen y points down, so this rotates clockwise
+  float radians = float(Helper::DegreesToRadians(angle)), cosine = cos(radians), sine = sin(radians);
+
+  int firstIndex = int(vertices.size());
+
+  for (int corner{0}; corner < 4; corner++)
+  {
+    auto [x, y] = corners[corner];
+
+    SDL_FPoint position{center.x + x * cosine - y * sine, center.y + x * sine + y * cosine};
+
+    vertices.push_back({position, color, coordinates[corner]});
+  }
+
+  // Two triangles
+  for (int offset : {0, 1, 2, 0, 2, 3})
+    indices.push_back(firstIndex + offset);
+}
+
+void SpriteBatch::Flush()
+{
+  if (indices.empty())
+    return;
+
+  Game::GetInstance().GetRenderThread().GetRecordingList().Geometry(batchTexture, vertices, indices);
+
+  stats.drawCalls++;
+
+  vertices.clear();
+  indices.clear();
+}
+
+SpriteBatch::Stats SpriteBatch::EndFrame()
+{
+  auto frameStats = stats;
+  stats = Stats();
+
+  return frameStats;
+}
+
+SpriteBatch::Stats SpriteBatch::GetStats() const { return stats; }
@@ -0,0 +1,123 @@
+#include "TextureAtlas.h"
+#include "Game.h"
+#include "Helper.h"
+#include <algorithm>
+
+using namespace std;
+using namespace Helper;
+
+// Transparent border kept around each image, so neighbors never bleed into each other
+static const int gutter{1};
+
+const int TextureAtlas::pageSize{2048};
+
+TextureAtlas::Region TextureAtlas::Pack(SDL_Surface *image)
+{
+  // The render thread may be using the renderer
+  RendererLock lock;
+
+  auto renderer = Game::GetInstance().GetRenderer();
+
+  int slotWidth = image->w + gutter * 2, slotHeight = image->h + gutter * 2;
+
+  // Too big for a page
+  if (slotWidth > pageSize || slotHeight > pageSize)
+  {
+    auto texture = SDL_CreateTextureFromSurface(renderer, image);
+
+    Assert(texture != nullptr, "Failed to create texture for atlas image");
+
+    return Region{shared_ptr<SDL_Texture>(texture, RenderThread::DestroyTexture), SDL_Rect{0, 0, image->w, image->h}};
+  }
+
+  // Find a page with room for it
+  SDL_Point corner;
+  Page *targetPage{nullptr};
+
+  for (auto &page : pages)
+    if (Allocate(page, slotWidth, slotHeight, corner))
+    {
+      targetPage = &page;
+      break;
+    }
+
+  if (targetPage == nullptr)
+  {
+    targetPage = &NewPage();
+
+    Assert(Allocate(*targetPage, slotWidth, slotHeight, corner), "Failed to allocate image in a new atlas page");
+  }
+
+  // Copy the image inside a transparent border, converting it to the page's format
+  auto_unique_ptr<SDL_Surface> slotSurface(
+      SDL_CreateRGBSurfaceWithFormat(0, slotWidth, slotHeight, 32, SDL_PIXELFORMAT_RGBA32), SDL_FreeSurface);
+
+  Assert(slotSurface != nullptr, "Failed to create surface for atlas image");
+
+  SDL_Rect imageRect{gutter, gutter, image->w, image->h};
+
+  SDL_SetSurfaceBlendMode(image, SDL_BLENDMODE_NONE);
+  SDL_BlitSurface(image, nullptr, slotSurface.get(), &imageRect);
+
+  // Upload it
+  SDL_Rect slotRect{corner.x, corner.y, slotWidth, slotHeight};
+
+  Assert(SDL_UpdateTexture(targetPage->texture.get(), &slotRect, slotSurface->pixels, slotSurface->pitch) == 0,
+         "Failed to upload image to atlas page");
+
+  return Region{targetPage->texture, SDL_Rect{corner.x + gutter, corner.y + gutter, image->w, image->h}, true};
+}
+
+bool TextureAtlas::Allocate(Page &page, int width, int height, SDL_Point &corner)
+{
+  // Pick the shortest shelf that fits it
+  Shelf *bestShelf{nullptr};
+
+  for (auto &shelf : page.shelves)
+    if (shelf.height >= height && pageSize - shelf.nextX >= width &&
+        (bestShelf == nullptr || shelf.height < bestShelf->height))
+      bestShelf = &shelf;
+
+  // Otherwise, open a new shelf
+  if (bestShelf == nullptr)
+  {
+    if (pageSize - page.nextShelfY < height)
+      return false;
+
+    page.shelves.push_back(Shelf{page.nextShelfY, height, 0});
+    page.nextShelfY += height;
+
+    bestShelf = &page.shelves.back();
+  }
+
+  corner = SDL_Point{bestShelf->nextX, bestShelf->y};
+  bestShelf->nextX += width;
+
+  return true;
+}
+
+TextureAtlas::Page &TextureAtlas::NewPage()
+{
+  auto texture = SDL_CreateTexture(
+      Game::GetInstance().GetRenderer(), SDL_PIXELFORMAT_RGBA32, SDL_TEXTUREACCESS_STATIC, pageSize, pageSize);
+
+  Assert(texture != nullptr, "Failed to create atlas page");
+
+  Page page;
+  page.texture = shared_ptr<SDL_Texture>(texture, RenderThread::DestroyTexture);
+
+  Game::GetInstance().GetRenderContext().SetTextureBlendMode(page.texture, SDL_BLENDMODE_BLEND);
+
+  pages.push_back(page);
+
+  return pages.back();
+}
+
+void TextureAtlas::ReleaseUnusedPages()
+{
+  // A page which only the atlas references has no regions in use
+  auto isUnused = [](const Page &page)
+  { return page.texture.use_count() == 1; };
+
+  pages.erase(remove_if(pages.begin(), pages.end(), isUnused), pages.end());
+}
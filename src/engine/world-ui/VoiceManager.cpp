@@ -0,0 +1,163 @@
+#include "VoiceManager.h"
+
+using namespace std;
+using namespace Helper;
+
+const VoiceManager::VoiceId VoiceManager::invalidVoice{-1};
+
+// Categories which play at the listener, and so are never attenuated or culled
+static bool IsWorldCategory(SoundCategory category)
+{
+  return category == SoundCategory::Effect || category == SoundCategory::Voice;
+}
+
+VoiceManager::VoiceManager(int channelCount)
+    : voices(Mix_AllocateChannels(channelCount)),
+      // Leave room for effects even with every voice, interface & ambience limit reached
+      categoryLimits{channelCount / 2, channelCount / 4, channelCount / 8, channelCount / 8}
+{
+  Assert(voices.empty() == false, "Failed to allocate mixer channels", Mix_GetError());
+
+  stats.channelCount = int(voices.size());
+}
+
+VoiceManager::~VoiceManager() { StopAll(); }
+
+VoiceManager::VoiceId VoiceManager::Play(int sample, int times, float distance)
+{
+  auto &config = SoundBank::GetSample(sample);
+  bool inWorld = IsWorldCategory(config.category);
+
+  if (inWorld && distance > cullDistance)
+  {
+    stats.culled++;
+    return invalidVoice;
+  }
+
+  // Find which channel to play on
+  int categoryVoices{0};
+  int freeChannel{-1};
+
+  for (int channel{0}; channel < int(voices.size()); channel++)
+  {
+    if (IsActive(channel) == false)
+    {
+      if (freeChannel < 0)
+        freeChannel = channel;
+    }
+    else if (voices[channel].category == config.category)
+      categoryVoices++;
+  }
+
+  int channel = freeChannel;
+
+  // When the category or the pool is full, steal a voice
+  if (categoryVoices >= categoryLimits[int(config.category)] || channel < 0)
+  {
+    channel = categoryVoices >= categoryLimits[int(config.category)] ? FindStealable(&config.category)
+                                                                     : FindStealable(nullptr);
+
+    if (channel < 0 || voices[channel].priority > config.priority)
+    {
+      stats.dropped++;
+      return invalidVoice;
+    }
+
+    Mix_HaltChannel(channel);
+    stats.stolen++;
+  }
+
+  // Decoded before, so this doesn't load anything
+  auto chunk = SoundBank::GetChunk(sample);
+
+  // Fade world voices with distance
+  float volume{1};
+
+  if (inWorld && distance > fullVolumeDistance)
+    volume = 1 - (distance - fullVolumeDistance) / (cullDistance - fullVolumeDistance);
+
+  // Before playing, so the mixer never mixes it at the channel's previous volume
+  Mix_Volume(channel, int(volume * MIX_MAX_VOLUME));
+
+  if (Mix_PlayChannel(channel, chunk, times - 1) < 0)
+  {
+    stats.dropped++;
+    return invalidVoice;
+  }
+
+  // Ids are unique per channel & play
+  VoiceId id = VoiceId(nextVoice) * voices.size() + channel;
+
+  voices[channel] = Voice{id, config.category, config.priority, nextVoice++};
+  stats.played++;
+
+  return id;
+}
+
+void VoiceManager::Stop(VoiceId voice)
+{
+  if (IsPlaying(voice))
+    Mix_HaltChannel(int(voice % voices.size()));
+}
+
+void VoiceManager::StopAll()
+{
+  Mix_HaltChannel(-1);
+
+  for (auto &voice : voices)
+    voice.id = invalidVoice;
+}
+
+bool VoiceManager::IsPlaying(VoiceId voice) const
+{
+  if (voice == invalidVoice)
+    return false;
+
+  int channel = int(voice % voices.size());
+
+  return voices[channel].id == voice && IsActive(channel);
+}
+
+void VoiceManager::SetCategoryLimit(SoundCategory category, int limit)
+{
+  Assert(limit >= 0, "Voice limits must not be negative");
+
+  categoryLimits[int(category)] = limit;
+}
+
+VoiceManager::Stats VoiceManager::GetStats() const
+{
+  auto currentStats = stats;
+
+  currentStats.activeVoices = 0;
+
+  for (int channel{0}; channel < int(voices.size()); channel++)
+    if (IsActive(channel))
+      currentStats.activeVoices++;
+
+  return currentStats;
+}
+
+bool VoiceManager::IsActive(int channel) const
+{
+  return voices[channel].id != invalidVoice && Mix_Playing(channel);
+}
+
+int VoiceManager::FindStealable(const SoundCategory *category) const
+{
+  int stealable{-1};
+
+  for (int channel{0}; channel < int(voices.size()); channel++)
+  {
+    if (IsActive(channel) == false || (category != nullptr && voices[channel].category != *category))
+      continue;
+
+    auto &voice = voices[channel];
+
+    if (stealable < 0 || voice.priority < voices[stealable].priority ||
+        (voice.priority == voices[stealable].priority && voice.startedAt < voices[stealable].startedAt))
+      stealable = channel;
+  }
+
+  return stealable;
+}
@@ -2,30 +2,94 @@
 #include "Animator.h"
 #include "Resources.h"
 #include <iostream>
+#include <unordered_map>
+#include <tuple>
 
 using namespace std;
 
 int Animation::idGenerator{0};
 
+// Parameters of a spritesheet slice
+struct SliceKey
+{
+  string filename;
+  int width, height, startingFrame, totalFrames;
+  int paddingLeft, paddingTop, paddingRight, paddingBottom;
+  int horizontalGap, verticalGap;
+  float frameDuration;
+  float offsetX, offsetY;
+  float pixelsPerUnit;
+  int targetWidth, targetHeight;
+
+  SliceKey(const string &filename, const SpritesheetClipInfo &clipInfo, float frameDuration, Vector2 offset, const SpriteConfig &config)
+      : filename(filename),
+        width(clipInfo.width), height(clipInfo.height), startingFrame(clipInfo.startingFrame), totalFrames(clipInfo.totalFrames),
+        paddingLeft(clipInfo.paddingLeft), paddingTop(clipInfo.paddingTop), paddingRight(clipInfo.paddingRight), paddingBottom(clipInfo.paddingBottom),
+        horizontalGap(clipInfo.horizontalGap), verticalGap(clipInfo.verticalGap),
+        frameDuration(frameDuration), offsetX(offset.x), offsetY(offset.y),
+        pixelsPerUnit(config.pixelsPerUnit), targetWidth(config.targetWidth), targetHeight(config.targetHeight) {}
+
+  auto Tie() const
+  {
+    return tie(filename, width, height, startingFrame, totalFrames, paddingLeft, paddingTop, paddingRight, paddingBottom,
+               horizontalGap, verticalGap, frameDuration, offsetX, offsetY, pixelsPerUnit, targetWidth, targetHeight);
+  }
+
+  bool operator==(const SliceKey &other) const { return Tie() == other.Tie(); }
+};
+
+struct SliceKeyHash
+{
+  size_t operator()(const SliceKey &key) const
+  {
+    // Animations of the same sheet usually differ in the starting frame or count
+    size_t hash = std::hash<string>()(key.filename);
+    hash = hash * 31 + size_t(key.startingFrame);
+    hash = hash * 31 + size_t(key.totalFrames);
+    hash = hash * 31 + size_t(key.width);
+
+    return hash;
+  }
+};
+
+// Frames of every spritesheet sliced so far, shared by all animations which slice it the same way
+// They hold no callbacks, so each animation gets it's own copy to add them to
+static unordered_map<SliceKey, shared_ptr<const vector<AnimationFrame>>, SliceKeyHash> sliceCache;
+
 Animation::Animation(Animator &animator) : animator(animator)
 {
-  auto weakAnimator{weak_ptr(RequirePointerCast<Animator>(animator.GetShared()))};
+  weakAnimator = RequirePointerCast<Animator>(animator.GetShared());
+}
+
+const vector<AnimationFrame> &Animation::Frames()
+{
+  if (frames != nullptr)
+    return *frames;
+
+  if (frameTables == nullptr)
+    frameTables = make_shared<FrameTables>();
+
+  auto variant = GetFramesVariant();
+
+  if (frameTables->size() <= variant)
+    frameTables->resize(variant + 1);
+
+  // The first to play this variant initializes it
+  auto &table = (*frameTables)[variant];
 
-  // Link it's event types to this animation's
-  OnCycleEnd.AddListener("animator-propagation", [this, weakAnimator]()
-                         { LOCK(weakAnimator, animator); animator->OnCycleEnd.Invoke(); });
+  if (table == nullptr)
+    table = make_shared<const vector<AnimationFrame>>(InitializeFrames());
 
-  OnStop.AddListener("animator-propagation", [this, weakAnimator]()
-                     { IF_LOCK(weakAnimator, animator)
-                       animator->OnAnimationStop.Invoke(); });
+  frames = table;
+
+  return *frames;
 }
 
-vector<AnimationFrame> &Animation::Frames()
+void Animation::AddCallback(int frame, function<void(WorldObject &)> callback)
 {
-  if (frames.empty())
-    frames = InitializeFrames();
+  Assert(frame >= 0 && frame < int(Frames().size()), "Invalid frame index");
 
-  return frames;
+  instanceCallbacks.emplace_back(frame, callback);
 }
 
 Animation::CycleEndBehavior &Animation::EndBehavior() { return endBehavior; }
@@ -34,7 +98,7 @@ float &Animation::SpeedModifier() { return speedModifier; }
 
 shared_ptr<Animation> Animation::GetNext() { return nullptr; }
 
-AnimationFrame &Animation::operator[](int index) { return GetFrame(index); }
+const AnimationFrame &Animation::operator[](int index) { return GetFrame(index); }
 
 void Animation::InternalStart(bool raise)
 {
@@ -60,10 +124,17 @@ void Animation::Stop()
 {
   InternalOnStop();
   OnStop.Invoke();
+
+  // Propagate to animator
+  IF_LOCK(weakAnimator, sharedAnimator)
+  {
+    sharedAnimator->OnAnimationStop.Invoke();
+  }
+
   currentFrame = 0;
 }
 
-AnimationFrame &Animation::GetFrame(int frame)
+const AnimationFrame &Animation::GetFrame(int frame)
 {
   Assert(frame >= 0 && frame < int(Frames().size()), "Invalid frame index");
 
@@ -75,7 +146,11 @@ void Animation::TriggerFrame(int frame)
   currentFrame = frame;
 
   // Trigger it
-  GetFrame(frame).Trigger(animator.worldObject);
+  GetFrame(frame).Trigger(animator.worldObject, *this);
+
+  for (auto &[callbackFrame, callback] : instanceCallbacks)
+    if (callbackFrame == frame)
+      callback(animator.worldObject);
 
   // Get next frame time
   secondsToNextFrame = GetFrame(frame).GetDuration() * speedModifier;
@@ -121,6 +196,23 @@ void Animation::Update(float deltaTime)
 }
 
 vector<AnimationFrame> Animation::SliceSpritesheet(string filename, SpritesheetClipInfo clipInfo, float frameDuration, Vector2 virtualPixelOffset, SpriteConfig config)
+{
+  SliceKey key{filename, clipInfo, frameDuration, virtualPixelOffset, config};
+
+  // Sliced before
+  if (auto cached = sliceCache.find(key); cached != sliceCache.end())
+    return *cached->second;
+
+  auto frames = SliceSpritesheetUncached(filename, clipInfo, frameDuration, virtualPixelOffset, config);
+
+  sliceCache.emplace(key, make_shared<const vector<AnimationFrame>>(frames));
+
+  return frames;
+}
+
+void Animation::ClearSliceCache() { sliceCache.clear(); }
+
+vector<AnimationFrame> Animation::SliceSpritesheetUncached(string filename, SpritesheetClipInfo clipInfo, float frameDuration, Vector2 virtualPixelOffset, SpriteConfig config)
 {
   // Get sprite
   auto sprite = Resources::GetSprite(filename);
@@ -190,6 +282,10 @@ void Animation::PassAndDelete()
   // Announce
   OnCycleEnd.Invoke();
 
+  // Propagate to animator
+  LOCK(weakAnimator, sharedAnimator);
+  sharedAnimator->OnCycleEnd.Invoke();
+
   // If loops, simply carry on
   if (EndBehavior() == CycleEndBehavior::Loop)
   {
@@ -21,6 +21,12 @@ AnimationFrame::AnimationFrame(shared_ptr<Sprite> sprite, float duration)
 }
 
 void AnimationFrame::AddCallback(function<void(WorldObject &)> callback)
+{
+  callbacks.push_back([callback](WorldObject &worldObject, Animation &)
+                      { callback(worldObject); });
+}
+
+void AnimationFrame::AddCallback(function<void(WorldObject &, Animation &)> callback)
 {
   callbacks.push_back(callback);
 }
@@ -42,11 +48,11 @@ float AnimationFrame::GetDuration() const
 
 void AnimationFrame::SetDuration(float value) { duration = value; }
 
-void AnimationFrame::Trigger(WorldObject &worldObject) const
+void AnimationFrame::Trigger(WorldObject &worldObject, Animation &animation) const
 {
   // Trigger the callbacks
-  for (auto callback : callbacks)
-    callback(worldObject);
+  for (auto &callback : callbacks)
+    callback(worldObject, animation);
 
   // Check if there is a sprite to set
   if (sprite != nullptr)
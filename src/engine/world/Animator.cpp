@@ -100,8 +100,19 @@ shared_ptr<Animation> Animator::GetCurrentAnimation() const { return currentAnim
 
 shared_ptr<Animation> Animator::GetIncomingAnimation() const { return incomingAnimation; }
 
-void Animator::RegisterAnimation(function<shared_ptr<Animation>()> animationBuilder, bool makeDefault)
+void Animator::RegisterAnimation(function<shared_ptr<Animation>()> typeBuilder, bool makeDefault)
 {
+  // Animations built from this registration share their frames, so they are only initialized once
+  auto frameTables = make_shared<Animation::FrameTables>();
+
+  auto animationBuilder = [typeBuilder, frameTables]()
+  {
+    auto animation = typeBuilder();
+    animation->frameTables = frameTables;
+
+    return animation;
+  };
+
   // Build a sample
   auto animation = animationBuilder();
 
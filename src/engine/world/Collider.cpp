@@ -14,6 +14,7 @@ void Collider::RegisterToScene()
 {
   // Id of worldObject on which to subscribe this collider
   ownerId = isTrigger ? worldObject.id : -1;
+  ownerHandle = isTrigger ? worldObject.handle : Handle();
 
   // Object to inspect for a rigidbody
   shared_ptr<WorldObject> inspectingObject = worldObject.GetShared();
@@ -28,7 +29,9 @@ void Collider::RegisterToScene()
     if (rigidbody != nullptr)
     {
       ownerId = rigidbody->worldObject.id;
+      ownerHandle = rigidbody->worldObject.handle;
       rigidbodyWeak = rigidbody;
+      rigidbodyHandle = rigidbody->handle;
       break;
     }
 
@@ -109,8 +112,12 @@ shared_ptr<Shape> Collider::DeriveShape() const
   return shapeCopy;
 }
 
+Rigidbody *Collider::GetRigidbody() const { return Resolve<Rigidbody>(rigidbodyHandle); }
+
 int Collider::GetOwnerId() const { return ownerId; }
 
+WorldObject *Collider::ResolveOwner() const { return GameObject::Resolve<WorldObject>(ownerHandle); }
+
 shared_ptr<WorldObject> Collider::GetOwner() const
 {
   return GetScene()->RequireWorldObject(GetOwnerId());
@@ -118,5 +125,5 @@ shared_ptr<WorldObject> Collider::GetOwner() const
 
 void Collider::OnBeforeDestroy()
 {
-  worldObject.HandleColliderDestruction(RequirePointerCast<Collider>(GetShared()));
+  worldObject.HandleColliderDestruction(*this);
 }
@@ -40,14 +40,31 @@ const Collision::distance_finder_map Collision::distanceFinder{
 
 // === COLLISION DATA
 
-size_t Collision::Data::GetHash() const
+Collider *Collision::Data::GetSource() const { return Component::Resolve<Collider>(source); }
+
+Collider *Collision::Data::GetOther() const { return Component::Resolve<Collider>(other); }
+
+Collider &Collision::Data::RequireSource() const
 {
-  auto source = weakSource.lock();
-  auto other = weakOther.lock();
+  auto collider = GetSource();
 
-  // Ensure valid pointers
-  Helper::Assert(source != nullptr && other != nullptr, "Failed to lock collision data's colliders");
-  return Helper::HashTwo(source->id, other->id);
+  Helper::Assert(collider != nullptr, "Collision data's source collider was already destroyed");
+  return *collider;
+}
+
+Collider &Collision::Data::RequireOther() const
+{
+  auto collider = GetOther();
+
+  Helper::Assert(collider != nullptr, "Collision data's other collider was already destroyed");
+  return *collider;
+}
+
+uint64_t Collision::Data::GetHash() const
+{
+  // Handles are unique among living colliders, so there's no need to resolve them
+  // Both fit side by side, so no two pairs ever share a hash
+  return (uint64_t(source.value) << 32) | other.value;
 }
 
 // === COLLISION METHODS
@@ -29,9 +29,17 @@ void ParticleEmitter::Render()
   origin->DebugDrawAt(worldObject.GetPosition(), Color::Yellow());
 #endif
 
-  // Render each of this emitter's particles
-  for (auto particle : GetEmittedParticles())
-    particle->Render();
+  // Render this emitter's particles
+  if (systemSlot >= 0)
+    GetSystem().Render(systemSlot);
+}
+
+void ParticleEmitter::OnBeforeDestroy()
+{
+  if (systemSlot >= 0)
+    GetSystem().ReleaseEmitter(systemSlot);
+
+  systemSlot = -1;
 }
 
 void ParticleEmitter::Start()
@@ -94,14 +102,7 @@ void ParticleEmitter::Emit()
   }
 
   // Create particle
-  auto particle = GetSystem().CreateParticle(
-      position, lifetime, Vector2::Angled(angle, speed), color, gravityModifier, currentParams.behavior);
-
-  // Attachment
-  particle->AttachTo(worldObject.GetShared());
-
-  // Register it
-  weakEmittedParticles.emplace_back(particle);
+  GetSystem().CreateParticle(GetSystemSlot(), position, lifetime, Vector2::Angled(angle, speed), color, gravityModifier);
 }
 
 void ParticleEmitter::StartEmission()
@@ -112,6 +113,9 @@ void ParticleEmitter::StartEmission()
 
   // Reset params
   currentParams = emission;
+
+  // Apply this cycle's behavior to the emitted particles
+  GetSystem().SetBehavior(GetSystemSlot(), currentParams.behavior);
 }
 
 void ParticleEmitter::Stop()
@@ -124,9 +128,13 @@ void ParticleEmitter::Stop()
   OnStop.Invoke();
 }
 
-list<shared_ptr<Particle>> ParticleEmitter::GetEmittedParticles()
+int ParticleEmitter::GetSystemSlot()
 {
-  return ParseWeakIntoShared(weakEmittedParticles);
+  // Particles follow this object's time scale
+  if (systemSlot < 0)
+    systemSlot = GetSystem().RegisterEmitter(worldObject.handle);
+
+  return systemSlot;
 }
 
 ParticleSystem &ParticleEmitter::GetSystem() const
@@ -1,41 +1,211 @@
 #include "ParticleSystem.h"
+#include "GameScene.h"
+#include "Camera.h"
+#include "Game.h"
+#include "Profiler.h"
 
 using namespace std;
 
-ParticleSystem::ParticleSystem(GameScene &gameScene) : gameScene(gameScene) {}
+const int ParticleSystem::capacity{32768};
 
-shared_ptr<Particle> ParticleSystem::CreateParticle(
-    Vector2 position, float lifetime, Vector2 velocity,
-    Color color, Vector2 gravityModifier, Particle::behavior_callback behavior)
+ParticleSystem::ParticleSystem(GameScene &gameScene)
+    : gameScene(gameScene),
+      positionX(capacity), positionY(capacity),
+      velocityX(capacity), velocityY(capacity),
+      gravityModifierX(capacity), gravityModifierY(capacity),
+      lifetimes(capacity), colors(capacity), particleSlots(capacity) {}
+
+int ParticleSystem::RegisterEmitter(Handle referenceObject)
+{
+  EmitterSlot newSlot;
+  newSlot.referenceObject = referenceObject;
+
+  // Reuse a slot which is no longer in use
+  for (int slot{0}; slot < int(slots.size()); slot++)
+    if (slots[slot].released && slots[slot].particleCount == 0)
+    {
+      slots[slot] = newSlot;
+      return slot;
+    }
+
+  slots.push_back(newSlot);
+  groupsValid = false;
+
+  return int(slots.size()) - 1;
+}
+
+void ParticleSystem::ReleaseEmitter(int slot)
 {
-  auto particle = make_shared<Particle>(*this, nextId++, position, lifetime, velocity, gravityModifier, color);
-  particle->behavior = behavior;
+  slots[slot].released = true;
+  slots[slot].behavior = nullptr;
+}
+
+void ParticleSystem::SetBehavior(int slot, Particle::behavior_callback behavior) { slots[slot].behavior = behavior; }
+
+bool ParticleSystem::CreateParticle(
+    int slot, Vector2 position, float lifetime, Vector2 velocity, Color color, Vector2 gravityModifier)
+{
+  if (count == capacity)
+    return false;
 
-  // Register it
-  particles[particle->id] = particle;
+  int index = count++;
 
-  return particle;
+  positionX[index] = position.x;
+  positionY[index] = position.y;
+  velocityX[index] = velocity.x;
+  velocityY[index] = velocity.y;
+  gravityModifierX[index] = gravityModifier.x;
+  gravityModifierY[index] = gravityModifier.y;
+  lifetimes[index] = lifetime;
+  colors[index] = color;
+  particleSlots[index] = slot;
+
+  slots[slot].particleCount++;
+  groupsValid = false;
+
+  return true;
 }
 
 void ParticleSystem::PhysicsUpdate(float deltaTime)
 {
-  // cout << particles.size() << " particles" << endl;
+  PROFILE_ZONE("ParticleSystem::PhysicsUpdate");
+
+  // Get each slot's delta time, using time scale from reference
+  slotDeltaTimes.resize(slots.size());
 
-  // Update each particle
-  for (auto [id, particle] : particles)
+  for (size_t slot{0}; slot < slots.size(); slot++)
   {
-    particle->PhysicsUpdate(deltaTime);
+    auto referenceObject = GameObject::Resolve(slots[slot].referenceObject);
+
+    slotDeltaTimes[slot] = referenceObject != nullptr ? deltaTime * referenceObject->GetTimeScale() : deltaTime;
+  }
+
+  // Apply behaviors
+  for (int index{0}; index < count; index++)
+  {
+    int slot = particleSlots[index];
+    auto &behavior = slots[slot].behavior;
+
+    if (!behavior)
+      continue;
+
+    Particle particle{
+        {positionX[index], positionY[index]},
+        {velocityX[index], velocityY[index]},
+        {gravityModifierX[index], gravityModifierY[index]},
+        colors[index],
+        lifetimes[index]};
+
+    behavior(particle, slotDeltaTimes[slot]);
+
+    positionX[index] = particle.position.x;
+    positionY[index] = particle.position.y;
+    velocityX[index] = particle.velocity.x;
+    velocityY[index] = particle.velocity.y;
+    gravityModifierX[index] = particle.gravityModifier.x;
+    gravityModifierY[index] = particle.gravityModifier.y;
+    colors[index] = particle.color;
+    lifetimes[index] = particle.lifetime;
+  }
+
+  // Integrate
+  const Vector2 gravity = gameScene.physicsSystem.gravity;
+
+  for (int index{0}; index < count; index++)
+  {
+    float particleDeltaTime = slotDeltaTimes[particleSlots[index]];
+
+    // Update velocity
+    velocityX[index] += gravity.x * gravityModifierX[index] * particleDeltaTime;
+    velocityY[index] += gravity.y * gravityModifierY[index] * particleDeltaTime;
+
+    // Update position
+    positionX[index] += velocityX[index] * particleDeltaTime;
+    positionY[index] += velocityY[index] * particleDeltaTime;
+
+    // Count lifetime
+    lifetimes[index] -= particleDeltaTime;
   }
 
   // Delete dead particles
-  auto particleIterator = particles.begin();
-  while (particleIterator != particles.end())
+  for (int index{0}; index < count;)
   {
-    if (particleIterator->second->DeleteRequested())
-      particleIterator = particles.erase(particleIterator);
+    if (lifetimes[index] <= 0)
+      Remove(index);
     else
-      particleIterator++;
+      index++;
   }
+
+  groupsValid = false;
+}
+
+void ParticleSystem::Remove(int index)
+{
+  slots[particleSlots[index]].particleCount--;
+
+  int last = --count;
+
+  positionX[index] = positionX[last];
+  positionY[index] = positionY[last];
+  velocityX[index] = velocityX[last];
+  velocityY[index] = velocityY[last];
+  gravityModifierX[index] = gravityModifierX[last];
+  gravityModifierY[index] = gravityModifierY[last];
+  lifetimes[index] = lifetimes[last];
+  colors[index] = colors[last];
+  particleSlots[index] = particleSlots[last];
+}
+
+void ParticleSystem::Group()
+{
+  // Count each slot's particles
+  groupStarts.assign(slots.size() + 1, 0);
+
+  for (int index{0}; index < count; index++)
+    groupStarts[particleSlots[index] + 1]++;
+
+  // Turn counts into offsets
+  for (size_t slot{1}; slot < groupStarts.size(); slot++)
+    groupStarts[slot] += groupStarts[slot - 1];
+
+  // Place indices
+  groupedIndices.resize(count);
+
+  vector<int> nextPosition(groupStarts.begin(), groupStarts.end() - 1);
+
+  for (int index{0}; index < count; index++)
+    groupedIndices[nextPosition[particleSlots[index]]++] = index;
+
+  groupsValid = true;
 }
 
-void ParticleSystem::DeleteParticle(int id) { particles.erase(id); }
\ No newline at end of file
+void ParticleSystem::Render(int slot)
+{
+  if (groupsValid == false)
+    Group();
+
+  // Get camera
+  auto camera = Camera::GetMain();
+
+  // Size of virtual pixel, in units
+  float virtualPixelSize = 1.0f / Game::defaultVirtualPixelsPerUnit;
+
+  // Size of virtual pixel, in real pixels
+  float pixelSize = camera->GetRealPixelsPerUnit() * virtualPixelSize;
+
+  auto &spriteBatch = Game::GetInstance().GetSpriteBatch();
+
+  // Fill a rect at each particle's position. They all end up in the same batch
+  for (int group{groupStarts[slot]}; group < groupStarts[slot + 1]; group++)
+  {
+    int index = groupedIndices[group];
+    Vector2 position{positionX[index], positionY[index]};
+
+    if (gameScene.Cull(position, virtualPixelSize, virtualPixelSize))
+      continue;
+
+    auto topLeft = camera->WorldToScreen(position) - Vector2{pixelSize, pixelSize} / 2;
+
+    spriteBatch.Fill({float(int(topLeft.x)), float(int(topLeft.y)), float(int(pixelSize)), float(int(pixelSize))}, colors[index]);
+  }
+}
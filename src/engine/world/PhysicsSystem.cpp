@@ -3,6 +3,8 @@
 #include "PlatformEffector.h"
 #include "PhysicsSystem.h"
 #include "GameScene.h"
+#include "Debug.h"
+#include "Profiler.h"
 #include <functional>
 #include <tuple>
 #include <algorithm>
@@ -17,7 +19,7 @@ const float maxFrictionCutSpeed{0.001f};
 // How many units to displace the raycast particle in each iteration
 const float raycastGranularity{0.15f};
 
-void ApplyImpulse(Collision::Data collisionData);
+void ApplyImpulse(const Collision::Data &collisionData);
 
 // Given that the 2 colliders collided, checks if a platform effector allows this collision through
 bool PlatformEffectorCheck(Collider &collider1, Collider &collider2);
@@ -26,13 +28,15 @@ PhysicsSystem::PhysicsSystem(GameScene &gameScene) : gameScene(gameScene) {}
 
 void PhysicsSystem::PhysicsUpdate(float)
 {
+  overlayContacts.clear();
+
   HandleCollisions();
 }
 
 bool PlatformEffectorCheck(Collider &collider1, Collider &collider2)
 {
   // Checks given a body and a collider
-  auto CheckFor = [](shared_ptr<Rigidbody> body, Collider &collider)
+  auto CheckFor = [](Rigidbody *body, Collider &collider)
   {
     if (body == nullptr)
       return false;
@@ -42,12 +46,12 @@ bool PlatformEffectorCheck(Collider &collider1, Collider &collider2)
     if (platform == nullptr)
       return false;
 
-    return platform->AllowThrough(body);
+    return platform->AllowThrough(*body);
   };
 
   // Both checks need to be performed (for PlatformEffector's internal state coherence), so we perform or on their already computed results
-  bool check1 = CheckFor(collider1.rigidbodyWeak.lock(), collider2);
-  bool check2 = CheckFor(collider2.rigidbodyWeak.lock(), collider1);
+  bool check1 = CheckFor(collider1.GetRigidbody(), collider2);
+  bool check2 = CheckFor(collider2.GetRigidbody(), collider1);
 
   return check1 || check2;
 }
@@ -55,22 +59,26 @@ bool PlatformEffectorCheck(Collider &collider1, Collider &collider2)
 // Returns whether the two collider lists have some pair of colliders which are intersecting
 // If there is, also populates the collision data struct
 bool PhysicsSystem::CheckForCollision(
-    vector<shared_ptr<Collider>> colliders1,
-    vector<shared_ptr<Collider>> colliders2,
+    const ColliderHandles &colliders1,
+    const ColliderHandles &colliders2,
     Collision::Data &collisionData,
     Vector2 displaceColliders1,
     float scaleColliders1)
 {
-  for (auto collider1 : colliders1)
+  for (auto handle1 : colliders1)
   {
-    // Verify if enabled
-    if (collider1->IsEnabled() == false)
+    auto collider1 = Component::Resolve<Collider>(handle1);
+
+    // Verify if valid & enabled
+    if (collider1 == nullptr || collider1->IsEnabled() == false)
       continue;
 
-    for (auto collider2 : colliders2)
+    for (auto handle2 : colliders2)
     {
-      // Verify if enabled
-      if (collider2->IsEnabled() == false)
+      auto collider2 = Component::Resolve<Collider>(handle2);
+
+      // Verify if valid & enabled
+      if (collider2 == nullptr || collider2->IsEnabled() == false)
         continue;
 
       // Verify collision matrix
@@ -89,8 +97,8 @@ bool PhysicsSystem::CheckForCollision(
         continue;
 
       // Populate collision data
-      collisionData.weakSource = collider1;
-      collisionData.weakOther = collider2;
+      collisionData.source = handle1;
+      collisionData.other = handle2;
       collisionData.normal = normal;
       collisionData.penetration = abs(distance);
 
@@ -101,8 +109,29 @@ bool PhysicsSystem::CheckForCollision(
   return false;
 }
 
+bool PhysicsSystem::SameLineage(Handle collider1, Handle collider2)
+{
+  auto owner1 = Component::Resolve<Collider>(collider1)->ResolveOwner();
+  auto owner2 = Component::Resolve<Collider>(collider2)->ResolveOwner();
+
+  Assert(owner1 != nullptr && owner2 != nullptr, "Registered collider had no owner");
+
+  return WorldObject::SameLineage(*owner1, *owner2);
+}
+
+Rigidbody *PhysicsSystem::ResolveBody(const ColliderHandles &colliders)
+{
+  for (auto handle : colliders)
+    if (auto collider = Component::Resolve<Collider>(handle); collider != nullptr)
+      return collider->GetRigidbody();
+
+  return nullptr;
+}
+
 void PhysicsSystem::HandleCollisions()
 {
+  PROFILE_ZONE("PhysicsSystem::HandleCollisions");
+
   // Get validated colliders
   auto dynamicColliders = ValidateAllColliders(dynamicColliderStructure);
   auto kinematicColliders = ValidateAllColliders(kinematicColliderStructure);
@@ -120,10 +149,10 @@ void PhysicsSystem::HandleCollisions()
     Assert(collidersIterator->empty() == false, "Collider entry was unexpectedly empty");
 
     // Check for continuous detection
-    auto objectBody = collidersIterator->at(0)->RequireRigidbody();
+    auto objectBody = ResolveBody(*collidersIterator);
 
-    // Check for disable
-    if (objectBody->IsEnabled() == false)
+    // Check for destruction & disable
+    if (objectBody == nullptr || objectBody->IsEnabled() == false)
       continue;
 
     if (objectBody->ShouldUseContinuousDetection())
@@ -134,83 +163,90 @@ void PhysicsSystem::HandleCollisions()
   }
 
   // Get triggers
-  auto triggerColliders = ValidateAllColliders(weakTriggerColliders);
+  auto triggers = ValidateAllColliders(triggerColliders);
 
   // Check trigger collisions for each trigger
   for (
-      auto triggerIterator = triggerColliders.begin();
-      triggerIterator != triggerColliders.end();
+      auto triggerIterator = triggers.begin();
+      triggerIterator != triggers.end();
       triggerIterator++)
   {
     // Get trigger data
-    auto triggerCollider = *triggerIterator;
-    auto triggerBody = triggerCollider->rigidbodyWeak.lock();
+    auto triggerHandle = *triggerIterator;
+    auto triggerCollider = Component::Resolve<Collider>(triggerHandle);
+
+    // It may have been destroyed by a previous collision's callbacks
+    if (triggerCollider == nullptr)
+      continue;
+
+    auto triggerBody = triggerCollider->GetRigidbody();
     bool isStatic = triggerBody == nullptr || triggerBody->IsStatic();
 
     // Store collision data
     static Collision::Collision::Data collisionData;
 
-    // Check against all dynamic objects
-    for (auto colliders : dynamicColliders)
+    // Checks the trigger against each of the given objects
+    auto checkAgainst = [&](const vector<ColliderHandles> &targets)
     {
-      if (WorldObject::SameLineage(
-              gameScene.RequireWorldObject(triggerCollider->GetOwnerId()),
-              gameScene.RequireWorldObject(colliders.at(0)->GetOwnerId())))
-        continue;
+      for (auto &colliders : targets)
+      {
+        // Skip objects whose colliders were all destroyed in the meantime
+        auto target = find_if(colliders.begin(), colliders.end(), [](Handle handle)
+                              { return Component::Resolve<Collider>(handle) != nullptr; });
 
-      if (CheckForCollision(colliders, {triggerCollider}, collisionData))
-        ResolveTriggerCollision(collisionData.weakSource.lock(), collisionData.weakOther.lock());
-    }
+        if (target == colliders.end() || Component::Resolve<Collider>(triggerHandle) == nullptr)
+          continue;
 
-    // Check against other statics only if not static
-    auto nonDynamicTargets = isStatic ? kinematicColliders : nonDynamicColliders;
-    for (auto colliders : nonDynamicTargets)
-    {
-      if (WorldObject::SameLineage(
-              gameScene.RequireWorldObject(triggerCollider->GetOwnerId()),
-              gameScene.RequireWorldObject(colliders.at(0)->GetOwnerId())))
-        continue;
+        if (SameLineage(triggerHandle, *target))
+          continue;
 
-      if (CheckForCollision(colliders, {triggerCollider}, collisionData))
-        ResolveTriggerCollision(collisionData.weakSource.lock(), collisionData.weakOther.lock());
-    }
+        if (CheckForCollision(colliders, {triggerHandle}, collisionData))
+          ResolveTriggerCollision(collisionData.source, collisionData.other);
+      }
+    };
+
+    // Check against all dynamic objects
+    checkAgainst(dynamicColliders);
+
+    // Check against other statics only if not static
+    checkAgainst(isStatic ? kinematicColliders : nonDynamicColliders);
 
     // Check against each other trigger collider
     for (
         auto otherTriggerIterator = triggerIterator;
-        otherTriggerIterator != triggerColliders.end();
+        otherTriggerIterator != triggers.end();
         otherTriggerIterator++)
     {
       // Get it's data
-      auto otherTriggerCollider = *otherTriggerIterator;
-      auto otherTriggerBody = otherTriggerCollider->rigidbodyWeak.lock();
+      auto otherTriggerHandle = *otherTriggerIterator;
+      auto otherTriggerCollider = Component::Resolve<Collider>(otherTriggerHandle);
+
+      if (otherTriggerCollider == nullptr || Component::Resolve<Collider>(triggerHandle) == nullptr)
+        continue;
+
+      auto otherTriggerBody = otherTriggerCollider->GetRigidbody();
 
-      if (WorldObject::SameLineage(
-              gameScene.RequireWorldObject(triggerCollider->GetOwnerId()),
-              gameScene.RequireWorldObject(otherTriggerCollider->GetOwnerId())))
+      if (SameLineage(triggerHandle, otherTriggerHandle))
         continue;
 
       // Ignore it if both are static
       if (isStatic && (otherTriggerBody == nullptr || otherTriggerBody->IsStatic()))
         continue;
 
-      if (CheckForCollision({otherTriggerCollider}, {triggerCollider}, collisionData))
-        ResolveTriggerCollision(collisionData.weakSource.lock(), collisionData.weakOther.lock());
+      if (CheckForCollision({otherTriggerHandle}, {triggerHandle}, collisionData))
+        ResolveTriggerCollision(collisionData.source, collisionData.other);
     }
   }
 }
 
 void PhysicsSystem::DetectObjectCollisions(
-    vector<ValidatedColliders>::iterator collidersIterator,
-    vector<ValidatedColliders>::iterator endIterator,
-    vector<ValidatedColliders> &nonDynamicColliders)
+    vector<ColliderHandles>::iterator collidersIterator,
+    vector<ColliderHandles>::iterator endIterator,
+    vector<ColliderHandles> &nonDynamicColliders)
 {
   // Will hold any collision data
   static Collision::Data collisionData;
 
-  // Body of this object
-  auto body = collidersIterator->at(0)->RequireRigidbody();
-
   // Test, for each OTHER dynamic object in the list (excluding the ones before this one)
   auto otherCollidersIterator{collidersIterator};
 
@@ -223,7 +259,7 @@ void PhysicsSystem::DetectObjectCollisions(
   }
 
   // Test for all non dynamic objects
-  for (auto otherColliders : nonDynamicColliders)
+  for (auto &otherColliders : nonDynamicColliders)
   {
     // cout << "Checking for object " << body->worldObject.GetName() << " with " << collidersIterator->second.size() << " colliders against " << otherColliders.at(0)->worldObject.GetName() << " with " << otherColliders.size() << " colliders" << endl;
     // Check if they are colliding
@@ -234,10 +270,10 @@ void PhysicsSystem::DetectObjectCollisions(
   }
 }
 
-void PhysicsSystem::DetectObjectBetweenFramesCollision(vector<ValidatedColliders>::iterator collidersIterator)
+void PhysicsSystem::DetectObjectBetweenFramesCollision(vector<ColliderHandles>::iterator collidersIterator)
 {
   // Get object body
-  auto objectBody = collidersIterator->at(0)->RequireRigidbody();
+  auto objectBody = ResolveBody(*collidersIterator);
 
   MESSAGE << "Using continuous detection for " << objectBody->worldObject.GetName() << endl;
 
@@ -252,21 +288,24 @@ void PhysicsSystem::DetectObjectBetweenFramesCollision(vector<ValidatedColliders
       objectBody->lastPosition,
       trajectory.Angle(),
       trajectory.Magnitude(),
-      castData);
+      castData,
+      CollisionFilter(),
+      1);
 
   // Trigger any found triggers
-  for (auto triggerData : castData.triggerCollisions)
-  {
-    LOCK(triggerData.weakSource, source);
-    LOCK(triggerData.weakOther, other);
-    ResolveTriggerCollision(source, other);
-  }
+  for (auto &triggerData : castData.triggerCollisions)
+    ResolveTriggerCollision(triggerData.source, triggerData.other);
 
   // If no collision, stop
   if (collisionFound == false)
     return;
 
-  LOCK(castData.collision.weakOther, otherCollider);
+  // Triggers may have destroyed the collider
+  auto otherCollider = castData.collision.GetOther();
+
+  if (otherCollider == nullptr)
+    return;
+
   MESSAGE << "Detected between frames collision with " << otherCollider->worldObject.GetName() << endl;
 
   // Move the body to where collision happened
@@ -277,35 +316,19 @@ void PhysicsSystem::DetectObjectBetweenFramesCollision(vector<ValidatedColliders
   ResolveCollision(castData.collision);
 }
 
-vector<shared_ptr<Collider>> PhysicsSystem::ValidateColliders(int id, WeakColliders &weakColliders)
+auto PhysicsSystem::ValidateColliders(int id, ColliderHandles &colliders) -> ColliderHandles
 {
   if (gameScene.RequireWorldObject(id) == nullptr)
     return {};
 
-  // Will hold verified colliders
-  vector<shared_ptr<Collider>> verifiedColliders;
+  // Remove expired colliders
+  auto expiredBegin = remove_if(colliders.begin(), colliders.end(), [](Handle handle)
+                                { return Component::Resolve<Collider>(handle) == nullptr; });
 
   // Will recalculate rigidbody mass if a collider is removed
-  bool colliderWasRemoved{false};
+  bool colliderWasRemoved{expiredBegin != colliders.end()};
 
-  // For each of it's colliders
-  auto colliderIterator = weakColliders.begin();
-  while (colliderIterator != weakColliders.end())
-  {
-    // Remove it if it's expired
-    if (colliderIterator->expired())
-    {
-      colliderIterator = weakColliders.erase(colliderIterator);
-      colliderWasRemoved = true;
-      continue;
-    }
-
-    // Otherwise lock it and add it
-    verifiedColliders.push_back(colliderIterator->lock());
-
-    // Advance
-    colliderIterator++;
-  }
+  colliders.erase(expiredBegin, colliders.end());
 
   if (colliderWasRemoved)
   {
@@ -319,28 +342,27 @@ vector<shared_ptr<Collider>> PhysicsSystem::ValidateColliders(int id, WeakCollid
     }
   }
 
-  return verifiedColliders;
+  return colliders;
 }
 
-auto PhysicsSystem::ValidateAllColliders(unordered_map<int, weak_ptr<Collider>> &weakColliders)
-    -> vector<shared_ptr<Collider>>
+auto PhysicsSystem::ValidateAllColliders(unordered_map<int, Handle> &handles) -> ColliderHandles
 {
-  vector<shared_ptr<Collider>> colliders;
+  ColliderHandles colliders;
 
   // For each object entry
-  auto collidersEntryIterator = weakColliders.begin();
-  while (collidersEntryIterator != weakColliders.end())
+  auto collidersEntryIterator = handles.begin();
+  while (collidersEntryIterator != handles.end())
   {
-    auto [objectId, weakCollider] = *collidersEntryIterator;
+    auto handle = collidersEntryIterator->second;
 
-    // If it's empty, remove it from the map
-    if (weakCollider.expired())
+    // If it's expired, remove it from the map
+    if (Component::Resolve<Collider>(handle) == nullptr)
     {
-      collidersEntryIterator = weakColliders.erase(collidersEntryIterator);
+      collidersEntryIterator = handles.erase(collidersEntryIterator);
       continue;
     }
 
-    colliders.push_back(weakCollider.lock());
+    colliders.push_back(handle);
     collidersEntryIterator++;
   }
 
@@ -353,14 +375,14 @@ auto PhysicsSystem::ValidateAllColliders(unordered_map<int, weak_ptr<Collider>>
   return colliders;
 }
 
-auto PhysicsSystem::ValidateAllColliders(unordered_map<int, WeakColliders> &weakColliders)
-    -> vector<ValidatedColliders>
+auto PhysicsSystem::ValidateAllColliders(unordered_map<int, ColliderHandles> &handles)
+    -> vector<ColliderHandles>
 {
-  vector<ValidatedColliders> verifiedCollidersStructure;
+  vector<ColliderHandles> verifiedCollidersStructure;
 
   // For each object entry
-  auto collidersEntryIterator = weakColliders.begin();
-  while (collidersEntryIterator != weakColliders.end())
+  auto collidersEntryIterator = handles.begin();
+  while (collidersEntryIterator != handles.end())
   {
     int objectId = collidersEntryIterator->first;
     auto objectColliders = ValidateColliders(objectId, collidersEntryIterator->second);
@@ -368,11 +390,11 @@ auto PhysicsSystem::ValidateAllColliders(unordered_map<int, WeakColliders> &weak
     // If it's empty, remove it from the map
     if (objectColliders.empty())
     {
-      collidersEntryIterator = weakColliders.erase(collidersEntryIterator);
+      collidersEntryIterator = handles.erase(collidersEntryIterator);
       continue;
     }
 
-    verifiedCollidersStructure.push_back(objectColliders);
+    verifiedCollidersStructure.push_back(move(objectColliders));
     collidersEntryIterator++;
   }
 
@@ -393,22 +415,22 @@ void PhysicsSystem::RegisterCollider(shared_ptr<Collider> collider, int objectId
   // Register triggers
   if (collider->isTrigger)
   {
-    weakTriggerColliders[collider->id] = collider;
+    triggerColliders[collider->id] = collider->handle;
     return;
   }
 
   // Get rigidbody if it exists
-  auto rigidbody = collider->rigidbodyWeak.lock();
+  auto rigidbody = collider->GetRigidbody();
 
   // Check if it's static
   bool isStatic = rigidbody == nullptr || rigidbody->IsStatic();
 
   if (isStatic)
-    staticColliderStructure[objectId].emplace_back(collider);
+    staticColliderStructure[objectId].push_back(collider->handle);
   else if (rigidbody->IsKinematic())
-    kinematicColliderStructure[objectId].emplace_back(collider);
+    kinematicColliderStructure[objectId].push_back(collider->handle);
   else
-    dynamicColliderStructure[objectId].emplace_back(collider);
+    dynamicColliderStructure[objectId].push_back(collider->handle);
 
   if (rigidbody != nullptr)
   {
@@ -427,11 +449,11 @@ void PhysicsSystem::RegisterCollider(shared_ptr<Collider> collider, int objectId
 }
 
 // Source https://youtu.be/1L2g4ZqmFLQ and https://research.ncl.ac.uk/game/mastersdegree/gametechnologies/previousinformation/physics6collisionresponse/
-void PhysicsSystem::ResolveCollision(Collision::Data collisionData1)
+void PhysicsSystem::ResolveCollision(const Collision::Data &collisionData1)
 {
   // cout << "Resolving collision between " << collisionData.source->worldObject.GetName() << " and " << collisionData.other->worldObject.GetName() << endl;
-  auto collider1 = collisionData1.weakSource.lock();
-  auto collider2 = collisionData1.weakOther.lock();
+  auto collider1 = collisionData1.GetSource();
+  auto collider2 = collisionData1.GetOther();
 
   if (collider1 == nullptr || collider2 == nullptr)
     return;
@@ -440,13 +462,21 @@ void PhysicsSystem::ResolveCollision(Collision::Data collisionData1)
   if (collider1->worldObject.CollisionDealtWith(collisionData1))
     return;
 
+  // Remember it for the overlay
+  if (showOverlay)
+  {
+    auto position = (collider1->DeriveShape()->center + collider2->DeriveShape()->center) / 2;
+
+    overlayContacts.push_back(OverlayContact{position, collisionData1.normal});
+  }
+
   // Build another collision data, and switch it's reference
   auto collisionData2{collisionData1};
-  swap(collisionData2.weakSource, collisionData2.weakOther);
+  swap(collisionData2.source, collisionData2.other);
 
   // Get bodies
-  auto body1 = collider1->rigidbodyWeak.lock();
-  auto body2 = collider2->rigidbodyWeak.lock();
+  auto body1 = collider1->GetRigidbody();
+  auto body2 = collider2->GetRigidbody();
 
   // Forget a body if it's the same object as the collider
   if (body1 != nullptr && body1->worldObject == collider1->worldObject)
@@ -478,18 +508,24 @@ void PhysicsSystem::ResolveCollision(Collision::Data collisionData1)
     body2->worldObject.OnCollision(collisionData2);
 }
 
-void PhysicsSystem::ResolveTriggerCollision(shared_ptr<Collider> collider1, shared_ptr<Collider> collider2)
+void PhysicsSystem::ResolveTriggerCollision(Handle handle1, Handle handle2)
 {
+  auto collider1 = Component::Resolve<Collider>(handle1);
+  auto collider2 = Component::Resolve<Collider>(handle2);
+
+  if (collider1 == nullptr || collider2 == nullptr)
+    return;
+
   // Create structs
-  TriggerCollisionData triggerData1{collider1, collider2}, triggerData2{collider2, collider1};
+  TriggerCollisionData triggerData1{handle1, handle2}, triggerData2{handle2, handle1};
 
   // If this collision was already dealt with this frame, ignore it
   if (collider1->worldObject.TriggerCollisionDealtWith(triggerData1))
     return;
 
   // Get bodies
-  auto body1 = collider1->rigidbodyWeak.lock();
-  auto body2 = collider2->rigidbodyWeak.lock();
+  auto body1 = collider1->GetRigidbody();
+  auto body2 = collider2->GetRigidbody();
 
   // Forget a body if it's the same object as the collider
   if (body1 != nullptr && body1->worldObject == collider1->worldObject)
@@ -518,11 +554,13 @@ void PhysicsSystem::ResolveTriggerCollision(shared_ptr<Collider> collider1, shar
     body2->worldObject.OnTriggerCollision(triggerData2);
 }
 
-void ApplyImpulse(Collision::Data collisionData)
+void ApplyImpulse(const Collision::Data &collisionData)
 {
   // Ease of access
-  auto bodyA = collisionData.weakSource.lock()->RequireRigidbody();
-  auto bodyB = collisionData.weakOther.lock()->RequireRigidbody();
+  auto bodyA = collisionData.RequireSource().GetRigidbody();
+  auto bodyB = collisionData.RequireOther().GetRigidbody();
+
+  Assert(bodyA != nullptr && bodyB != nullptr, "Collider required a rigidbody but didn't have one");
 
   // Friction to apply
   float frictionModifier = min(bodyA->friction, bodyB->friction);
@@ -577,6 +615,13 @@ void PhysicsSystem::UnregisterColliders(int objectId)
   staticColliderStructure.erase(objectId);
 }
 
+void PhysicsSystem::UnregisterObjects(const vector<int> &objectIds)
+{
+  for (auto structure : {&dynamicColliderStructure, &kinematicColliderStructure, &staticColliderStructure})
+    for (int objectId : objectIds)
+      structure->erase(objectId);
+}
+
 Vector2 PhysicsSystem::ApplyFriction(Vector2 velocity, float friction, float timeScale)
 {
   if (!velocity || friction == 0)
@@ -641,22 +686,24 @@ bool PhysicsSystem::Raycast(Vector2 origin, float angle, float maxDistance, Rayc
   return false;
 }
 
-bool PhysicsSystem::DetectRaycastCollisions(Vector2 particle, RaycastData &data, CollisionFilter filter)
+bool PhysicsSystem::DetectRaycastCollisions(Vector2 particle, RaycastData &data, const CollisionFilter &filter)
 {
   // For a given collider structure, performs the check
-  auto CheckForStructure = [&](unordered_map<int, PhysicsSystem::WeakColliders> structure)
+  auto CheckForStructure = [&](unordered_map<int, ColliderHandles> &structure)
   {
-    for (auto bodyColliders : ValidateAllColliders(structure))
+    for (auto &bodyColliders : ValidateAllColliders(structure))
     {
-      auto bodyId = bodyColliders.at(0)->GetOwnerId();
+      auto bodyId = Component::Resolve<Collider>(bodyColliders.at(0))->GetOwnerId();
 
       // Skip filtered bodies
       if (filter.ignoredObjects.count(bodyId) > 0)
         continue;
 
       // For each collider
-      for (auto collider : bodyColliders)
+      for (auto handle : bodyColliders)
       {
+        auto collider = Component::Resolve<Collider>(handle);
+
         // Check if particle is far enough that we don't need to bother
         float sqrParticleDistance = Vector2::SqrDistance(collider->DeriveShape()->center, particle);
         float maxEdgeCenterDistance = collider->DeriveShape()->GetMaxDimension() / 2;
@@ -667,7 +714,7 @@ bool PhysicsSystem::DetectRaycastCollisions(Vector2 particle, RaycastData &data,
         // Detect collision
         if (collider->DeriveShape()->Contains(particle))
         {
-          data.other = collider;
+          data.other = handle;
 
           return true;
         }
@@ -680,13 +727,25 @@ bool PhysicsSystem::DetectRaycastCollisions(Vector2 particle, RaycastData &data,
   return CheckForStructure(dynamicColliderStructure) || CheckForStructure(kinematicColliderStructure) || CheckForStructure(staticColliderStructure);
 }
 
-bool PhysicsSystem::ColliderCast(vector<shared_ptr<Collider>> colliders, Vector2 origin, float angle, float maxDistance, CollisionFilter filter, float colliderSizeScale)
+bool PhysicsSystem::ColliderCast(const vector<shared_ptr<Collider>> &colliders, Vector2 origin, float angle, float maxDistance, const CollisionFilter &filter, float colliderSizeScale)
 {
   ColliderCastData discardedData;
   return ColliderCast(colliders, origin, angle, maxDistance, discardedData, filter, colliderSizeScale);
 }
 
-bool PhysicsSystem::ColliderCast(vector<shared_ptr<Collider>> colliders, Vector2 origin, float angle, float maxDistance, ColliderCastData &data, CollisionFilter filter, float colliderSizeScale)
+bool PhysicsSystem::ColliderCast(const vector<shared_ptr<Collider>> &colliders, Vector2 origin, float angle, float maxDistance, ColliderCastData &data, const CollisionFilter &filter, float colliderSizeScale)
+{
+  // Convert to handles once
+  ColliderHandles handles;
+  handles.reserve(colliders.size());
+
+  for (auto &collider : colliders)
+    handles.push_back(collider->handle);
+
+  return ColliderCast(handles, origin, angle, maxDistance, data, filter, colliderSizeScale);
+}
+
+bool PhysicsSystem::ColliderCast(const ColliderHandles &colliders, Vector2 origin, float angle, float maxDistance, ColliderCastData &data, const CollisionFilter &filter, float colliderSizeScale)
 {
   if (colliders.size() == 0)
     return false;
@@ -694,12 +753,12 @@ bool PhysicsSystem::ColliderCast(vector<shared_ptr<Collider>> colliders, Vector2
   data.triggerCollisions.clear();
 
   // Vector to displace from colliders' current position to the origin parameter
-  Vector2 originDisplacement = origin - colliders[0]->worldObject.GetPosition();
+  Vector2 originDisplacement = origin - Component::Resolve<Collider>(colliders[0])->worldObject.GetPosition();
 
   // Get the min collider dimension
   float minColliderDimension{numeric_limits<float>::max()};
-  for (auto collider : colliders)
-    minColliderDimension = min(minColliderDimension, collider->DeriveShape()->GetMinDimension());
+  for (auto handle : colliders)
+    minColliderDimension = min(minColliderDimension, Component::Resolve<Collider>(handle)->DeriveShape()->GetMinDimension());
 
   // How much the colliders have already been displaced
   float displacement{0};
@@ -723,19 +782,19 @@ bool PhysicsSystem::ColliderCast(vector<shared_ptr<Collider>> colliders, Vector2
 }
 
 // Returns whether detected a collision between the given colliders and any bodies
-bool PhysicsSystem::DetectColliderCastCollisions(vector<shared_ptr<Collider>> colliders, Vector2 displacement, ColliderCastData &data, CollisionFilter filter, float colliderSizeScale)
+bool PhysicsSystem::DetectColliderCastCollisions(const ColliderHandles &colliders, Vector2 displacement, ColliderCastData &data, const CollisionFilter &filter, float colliderSizeScale)
 {
   // Keep track of our colliders' owner ids
   unordered_set<int> collidersIds;
-  for (auto collider : colliders)
-    collidersIds.insert(collider->GetOwnerId());
+  for (auto handle : colliders)
+    collidersIds.insert(Component::Resolve<Collider>(handle)->GetOwnerId());
 
   // For a given collider structure, performs the check
-  auto CheckForStructure = [&](unordered_map<int, PhysicsSystem::WeakColliders> &structure)
+  auto CheckForStructure = [&](unordered_map<int, ColliderHandles> &structure)
   {
-    for (auto otherColliders : ValidateAllColliders(structure))
+    for (auto &otherColliders : ValidateAllColliders(structure))
     {
-      auto otherId = otherColliders.at(0)->GetOwnerId();
+      auto otherId = Component::Resolve<Collider>(otherColliders.at(0))->GetOwnerId();
 
       // Skip filtered bodies & these colliders's owners
       if (filter.ignoredObjects.count(otherId) > 0 || collidersIds.count(otherId) > 0)
@@ -750,9 +809,9 @@ bool PhysicsSystem::DetectColliderCastCollisions(vector<shared_ptr<Collider>> co
   };
 
   // Detect triggers
-  for (auto otherCollider : ValidateAllColliders(weakTriggerColliders))
+  for (auto otherHandle : ValidateAllColliders(triggerColliders))
   {
-    auto otherId = otherCollider->GetOwnerId();
+    auto otherId = Component::Resolve<Collider>(otherHandle)->GetOwnerId();
 
     // Skip filtered bodies & these colliders's owners
     if (filter.ignoredObjects.count(otherId) > 0 || collidersIds.count(otherId) > 0)
@@ -760,14 +819,49 @@ bool PhysicsSystem::DetectColliderCastCollisions(vector<shared_ptr<Collider>> co
 
     // Detect collisions between the given colliders
     Collision::Collision::Data triggerCollision;
-    if (CheckForCollision(colliders, {otherCollider}, triggerCollision, displacement, colliderSizeScale))
+    if (CheckForCollision(colliders, {otherHandle}, triggerCollision, displacement, colliderSizeScale))
     {
       TriggerCollisionData triggerData;
-      triggerData.weakSource = triggerCollision.weakSource;
-      triggerData.weakOther = triggerCollision.weakOther;
+      triggerData.source = triggerCollision.source;
+      triggerData.other = triggerCollision.other;
       data.triggerCollisions.push_back(triggerData);
     }
   }
 
   return CheckForStructure(dynamicColliderStructure) || CheckForStructure(kinematicColliderStructure) || CheckForStructure(staticColliderStructure);
 }
+
+void PhysicsSystem::DrawOverlay()
+{
+  // Draws a collider, if it still exists
+  auto drawCollider = [](Handle handle, Color color)
+  {
+    if (auto collider = Component::Resolve<Collider>(handle); collider != nullptr)
+      collider->DeriveShape()->DebugDrawAt(Vector2::Zero(), color);
+  };
+
+  // Draws each collider of a structure
+  auto drawColliders = [drawCollider](const ColliderHandles &colliders, Color color)
+  {
+    for (auto handle : colliders)
+      drawCollider(handle, color);
+  };
+
+  for (auto &[id, colliders] : dynamicColliderStructure)
+    drawColliders(colliders, Color::Green());
+
+  for (auto &[id, colliders] : kinematicColliderStructure)
+    drawColliders(colliders, Color::Cyan());
+
+  for (auto &[id, colliders] : staticColliderStructure)
+    drawColliders(colliders, Color::Gray());
+
+  for (auto &[id, collider] : triggerColliders)
+    drawCollider(collider, Color::Yellow());
+
+  // Contact normals
+  static const float normalLength{0.5f};
+
+  for (auto &contact : overlayContacts)
+    Debug::DrawArrow(contact.position, contact.position + contact.normal * normalLength, Color::Red(), normalLength / 3);
+}
@@ -30,7 +30,7 @@ void PlatformEffector::WhitelistRemove(shared_ptr<Rigidbody> body)
 }
 
 // Whether the given body should or not be allowed to not collide with this platform at this frame
-bool PlatformEffector::AllowThrough(shared_ptr<Rigidbody> body)
+bool PlatformEffector::AllowThrough(const Rigidbody &body)
 {
   // if (whitelistedIds.count(body->id) > 0)
   //   cout << "Allowed by whitelist" << endl;
@@ -48,9 +48,9 @@ bool PlatformEffector::AllowThrough(shared_ptr<Rigidbody> body)
   //   cout << "NOT allowed" << endl;
 
   // Allow if body is whitelisted, or was allowed this or the very last frame, or is within the arc
-  if (whitelistedIds.count(body->id) > 0 ||
-      allowedIds.count(body->id) > 0 ||
-      lastAllowedIds.count(body->id) > 0 ||
+  if (whitelistedIds.count(body.id) > 0 ||
+      allowedIds.count(body.id) > 0 ||
+      lastAllowedIds.count(body.id) > 0 ||
       IsBodyInArc(body))
   {
     RegisterAllowedBody(body);
@@ -60,19 +60,19 @@ bool PlatformEffector::AllowThrough(shared_ptr<Rigidbody> body)
   return false;
 }
 
-bool PlatformEffector::IsBodyInArc(shared_ptr<Rigidbody> body)
+bool PlatformEffector::IsBodyInArc(const Rigidbody &body)
 {
   // Ignore irrelevant speeds
-  if (body->velocity.SqrMagnitude() < 0.001f)
+  if (body.velocity.SqrMagnitude() < 0.001f)
     return false;
 
-  float velocityAngle = body->velocity.Angle();
+  float velocityAngle = body.velocity.Angle();
 
   return (passThroughArc.first <= velocityAngle && velocityAngle <= passThroughArc.second) ||
          (passThroughArc.second <= velocityAngle && velocityAngle <= passThroughArc.first);
 }
 
-void PlatformEffector::RegisterAllowedBody(shared_ptr<Rigidbody> body)
+void PlatformEffector::RegisterAllowedBody(const Rigidbody &body)
 {
-  allowedIds.insert(body->id);
+  allowedIds.insert(body.id);
 }
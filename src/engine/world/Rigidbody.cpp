@@ -54,6 +54,16 @@ void Rigidbody::KinematicBodyUpdate(float deltaTime)
 {
   // Move according to velocity
   worldObject.Translate(velocity * deltaTime);
+
+  // Only bodies move on their own, so only they need to be confined to the collection range
+  auto absolutePosition = worldObject.GetPosition().GetAbsolute();
+
+  if (absolutePosition.x > WorldObject::objectCollectionRange || absolutePosition.y > WorldObject::objectCollectionRange)
+  {
+    MESSAGE << "Collecting " << worldObject << " for exceeding collection range" << endl;
+
+    worldObject.RequestDestroy();
+  }
 }
 
 void Rigidbody::UseAutoMass(bool value)
@@ -100,15 +110,21 @@ vector<shared_ptr<Collider>> Rigidbody::GetColliders() const
 {
   auto &physicsSystem = GetScene()->physicsSystem;
 
-  PhysicsSystem::WeakColliders weakColliders;
+  PhysicsSystem::ColliderHandles handles;
   if (IsStatic())
-    weakColliders = physicsSystem.staticColliderStructure[worldObject.id];
+    handles = physicsSystem.staticColliderStructure[worldObject.id];
   else if (IsKinematic())
-    weakColliders = physicsSystem.kinematicColliderStructure[worldObject.id];
+    handles = physicsSystem.kinematicColliderStructure[worldObject.id];
   else
-    weakColliders = physicsSystem.dynamicColliderStructure[worldObject.id];
+    handles = physicsSystem.dynamicColliderStructure[worldObject.id];
+
+  vector<shared_ptr<Collider>> colliders;
+
+  // Only get shared pointers once handles are validated
+  for (auto handle : physicsSystem.ValidateColliders(worldObject.id, handles))
+    colliders.push_back(RequirePointerCast<Collider>(Resolve<Collider>(handle)->GetShared()));
 
-  return physicsSystem.ValidateColliders(worldObject.id, weakColliders);
+  return colliders;
 }
 
 void Rigidbody::ApplyImpulse(Vector2 impulse)
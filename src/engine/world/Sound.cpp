@@ -1,50 +1,72 @@
 #include "Sound.h"
-#include "Resources.h"
+#include "Camera.h"
+#include "Game.h"
 
 using namespace Helper;
 using namespace std;
 
 Sound::Sound(GameObject &associatedObject, unordered_map<string, string> sounds)
-    : WorldComponent(associatedObject), sounds(sounds) {}
-
-void Sound::Play(string sound, int times)
+    : WorldComponent(associatedObject)
 {
-  Assert(sounds.count(sound) > 0, "Sound " + sound + " was never registered");
+  for (auto [sound, path] : sounds)
+    AddAudio(sound, path);
+}
 
-  // Get chunk
-  std::shared_ptr<Mix_Chunk> chunk;
+int Sound::AddAudio(string sound, string path, SoundCategory category, int priority)
+{
+  return samples[sound] = SoundBank::Register(path, category, priority);
+}
 
-  // If it hasn't been loaded before
-  if (chunks.count(sound) == 0)
-    chunks[sound] = Resources::GetSound(sounds.at(sound));
+int Sound::GetSample(string sound) const
+{
+  auto sampleIterator = samples.find(sound);
 
-  chunk = chunks.at(sound);
+  Assert(sampleIterator != samples.end(), "Sound " + sound + " was never registered");
 
-  // Play and memorize channel
-  channels[sound] = Mix_PlayChannel(-1, chunk.get(), times - 1);
+  return sampleIterator->second;
 }
 
-void Sound::Stop()
+void Sound::Play(int sample, int times)
 {
-  // Stop all channels
-  for (auto [sound, channel] : channels)
-    Stop(sound);
+  auto &voiceManager = Game::GetInstance().GetVoiceManager();
+
+  // Forget voices which finished
+  voices.erase(remove_if(voices.begin(), voices.end(), [&voiceManager](const pair<int, VoiceManager::VoiceId> &voice)
+                         { return voiceManager.IsPlaying(voice.second) == false; }),
+               voices.end());
+
+  // Listen from the camera
+  float distance = Vector2::Distance(worldObject.GetPosition(), Camera::GetMain()->GetPosition());
+
+  auto voice = voiceManager.Play(sample, times, distance);
+
+  if (voice != VoiceManager::invalidVoice)
+    voices.emplace_back(sample, voice);
 }
 
-void Sound::Stop(string sound)
+void Sound::Stop()
 {
-  // If no channel for this sound, ignore
-  if (channels.count(sound) == 0)
-    return;
+  auto &voiceManager = Game::GetInstance().GetVoiceManager();
 
-  // Stop it
-  Mix_HaltChannel(channels.at(sound));
+  for (auto [sample, voice] : voices)
+    voiceManager.Stop(voice);
 
-  // Reset it
-  channels.erase(sound);
+  voices.clear();
 }
 
-void Sound::AddAudio(std::string sound, std::string path)
+void Sound::Stop(int sample)
 {
-  sounds[sound] = path;
+  auto &voiceManager = Game::GetInstance().GetVoiceManager();
+
+  for (auto voiceIterator = voices.begin(); voiceIterator != voices.end();)
+  {
+    if (voiceIterator->first != sample)
+    {
+      voiceIterator++;
+      continue;
+    }
+
+    voiceManager.Stop(voiceIterator->second);
+    voiceIterator = voices.erase(voiceIterator);
+  }
 }
@@ -52,9 +52,9 @@ void SpriteRenderer::Render(Vector2 position)
   auto camera = Camera::GetMain();
   auto pixelPosition = camera->WorldToScreen(position);
 
-  SDL_Rect destinationRect = {
-      int(pixelPosition.x), int(pixelPosition.y),
-      int(width * camera->GetRealPixelsPerUnit()), int(height * camera->GetRealPixelsPerUnit())};
+  SDL_FRect destinationRect = {
+      float(int(pixelPosition.x)), float(int(pixelPosition.y)),
+      float(int(width * camera->GetRealPixelsPerUnit())), float(int(height * camera->GetRealPixelsPerUnit()))};
 
   // Detect flips
   SDL_RendererFlip horizontalFlip = worldObject.localScale.x < 0 ? SDL_FLIP_HORIZONTAL : SDL_FLIP_NONE;
@@ -63,21 +63,14 @@ void SpriteRenderer::Render(Vector2 position)
   // Get source clip
   auto sourceRect = sprite->GetClip();
 
-  // Puts the texture in the renderer
-  auto render = [&](SDL_Texture *texture)
-  {
-    SDL_RenderCopyEx(
-        Game::GetInstance().GetRenderer(),
-        texture,
-        &sourceRect,
-        &destinationRect,
-        Helper::RadiansToDegrees(worldObject.GetRotation()),
-        nullptr,
-        SDL_RendererFlip(horizontalFlip | verticalFlip));
-  };
-
-  // Apply render procedure
-  UseTexture(render);
+  // Queue it, with color modulation baked in
+  Game::GetInstance().GetSpriteBatch().Draw(
+      sprite->GetTexture(),
+      sourceRect,
+      destinationRect,
+      modulateColor,
+      Helper::RadiansToDegrees(worldObject.GetRotation()),
+      SDL_RendererFlip(horizontalFlip | verticalFlip));
 }
 
 Vector2 SpriteRenderer::GetOffset() const { return offset; }
@@ -86,28 +79,8 @@ void SpriteRenderer::SetOffset(Vector2 newOffset)
 {
   offset = newOffset;
   OnSetOffset.Invoke(offset);
-}
-
-void SpriteRenderer::UseTexture(function<void(SDL_Texture *)> procedure)
-{
-  // Get texture from sprite
-  auto texture = sprite->GetTexture();
-
-  // Apply color modulation
-  if (modulateColor != Color::White())
-  {
-    SDL_SetTextureColorMod(texture.get(), modulateColor.red, modulateColor.green, modulateColor.blue);
-
-    if (modulateColor.alpha < 255)
-      SDL_SetTextureAlphaMod(texture.get(), modulateColor.alpha);
-  }
 
-  // Execute procedure
-  procedure(texture.get());
-
-  // Revert modifications to texture
-  SDL_SetTextureColorMod(texture.get(), 255, 255, 255);
-  SDL_SetTextureAlphaMod(texture.get(), 255);
+  ChangedContent();
 }
 
 void SpriteRenderer::SetColor(Color modulateColor, Color addColor)
@@ -118,8 +91,7 @@ void SpriteRenderer::SetColor(Color modulateColor, Color addColor)
   if (addColor.IsValid())
     this->addColor = addColor;
 
-  // Reset generated texture
-  lastTexture = nullptr;
+  ChangedContent();
 }
 
 pair<Color, Color> SpriteRenderer::GetColors() const { return {modulateColor, addColor}; }
@@ -128,15 +100,24 @@ void SpriteRenderer::SetSprite(shared_ptr<Sprite> newSprite)
 {
   sprite = newSprite;
 
-  // Reset generated texture
-  lastTexture = nullptr;
+  ChangedContent();
 }
 
 shared_ptr<Sprite> SpriteRenderer::GetSprite() const { return sprite; }
 
-void SpriteRenderer::OverrideWidthPixels(int newWidth) { overrideWidthPixels = newWidth; }
+void SpriteRenderer::OverrideWidthPixels(int newWidth)
+{
+  overrideWidthPixels = newWidth;
+
+  ChangedContent();
+}
 
-void SpriteRenderer::SetAnchorPoint(Vector2 point) { anchorPoint = point; }
+void SpriteRenderer::SetAnchorPoint(Vector2 point)
+{
+  anchorPoint = point;
+
+  ChangedContent();
+}
 
 pair<float, float> SpriteRenderer::GetSpriteDimensionsParallax(shared_ptr<Sprite> referenceSprite) const
 {
@@ -183,8 +164,12 @@ void SpriteRenderer::SetParallax(float parallax, float referenceCameraSize)
 {
   this->parallax = parallax;
   parallaxReferenceCameraSize = referenceCameraSize;
+
+  ChangedContent();
 }
 
+float SpriteRenderer::GetParallax() const { return parallax; }
+
 Vector2 SpriteRenderer::ApplyParallax(Vector2 position) const
 {
   if (parallax == 0)
@@ -202,7 +187,30 @@ Vector2 SpriteRenderer::ApplyParallax(Vector2 position) const
       parallax);
 }
 
-void SpriteRenderer::SetRenderOrder(int newOrder) { renderOrder = newOrder; }
+void SpriteRenderer::SetRenderOrder(int newOrder)
+{
+  renderOrder = newOrder;
+
+  ChangedContent();
+}
+
+bool SpriteRenderer::GetWorldBounds(Rectangle &bounds)
+{
+  if (sprite == nullptr)
+    return false;
+
+  auto [width, height] = GetSpriteDimensionsParallax();
+
+  auto center = RenderPositionFor(worldObject.GetPosition()) + Vector2(width, height) / 2;
+
+  // When rotated, it may reach up to it's diagonal in any direction
+  if (worldObject.GetRotation() != 0)
+    width = height = Vector2(width, height).Magnitude();
+
+  bounds = Rectangle(center, width, height);
+
+  return true;
+}
 
 Vector2 SpriteRenderer::GetVirtualPixelOffset(Vector2 virtualPixel, std::shared_ptr<Sprite> referenceSprite) const
 {
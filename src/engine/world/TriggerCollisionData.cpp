@@ -1,12 +1,29 @@
 #include "TriggerCollisionData.h"
 #include "Collider.h"
 
-size_t TriggerCollisionData::GetHash() const
+Collider *TriggerCollisionData::GetSource() const { return Component::Resolve<Collider>(source); }
+
+Collider *TriggerCollisionData::GetOther() const { return Component::Resolve<Collider>(other); }
+
+Collider &TriggerCollisionData::RequireSource() const
 {
-  auto source = weakSource.lock();
-  auto other = weakOther.lock();
+  auto collider = GetSource();
 
-  // Ensure valid pointers
-  Helper::Assert(source != nullptr && other != nullptr, "Failed to lock collision data's colliders");
-  return Helper::HashTwo(source->id, other->id);
+  Helper::Assert(collider != nullptr, "Trigger collision data's source collider was already destroyed");
+  return *collider;
+}
+
+Collider &TriggerCollisionData::RequireOther() const
+{
+  auto collider = GetOther();
+
+  Helper::Assert(collider != nullptr, "Trigger collision data's other collider was already destroyed");
+  return *collider;
+}
+
+uint64_t TriggerCollisionData::GetHash() const
+{
+  // Handles are unique among living colliders, so there's no need to resolve them
+  // Both fit side by side, so no two pairs ever share a hash
+  return (uint64_t(source.value) << 32) | other.value;
 }
\ No newline at end of file
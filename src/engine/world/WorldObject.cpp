@@ -2,6 +2,7 @@
 #include "WorldObject.h"
 #include "Sound.h"
 #include "Game.h"
+#include "ComponentProfiler.h"
 #include <iostream>
 
 using namespace std;
@@ -24,6 +25,7 @@ WorldObject::WorldObject(string name, Vector2 coordinates, double rotation, shar
 
     // Add reference to parent
     this->weakParent = parent;
+    parentHandle = parent->handle;
 
     // Parent will get reference to this object upon it's registration to the scene
     // That's because this object's shared pointer hasn't been created yet!
@@ -38,22 +40,6 @@ WorldObject::WorldObject(string name, Vector2 coordinates, double rotation, shar
 
 WorldObject::~WorldObject() {}
 
-void WorldObject::Update(float deltaTime)
-{
-  // Usual updates
-  GameObject::Update(deltaTime);
-
-  // Check range collection
-  auto absolutePosition = GetPosition().GetAbsolute();
-
-  if (absolutePosition.x > objectCollectionRange || absolutePosition.y > objectCollectionRange)
-  {
-    MESSAGE << "Collecting " << *this << " for exceeding collection range" << endl;
-
-    RequestDestroy();
-  }
-}
-
 void WorldObject::PhysicsUpdate(float deltaTime)
 {
   // Usual updates
@@ -67,110 +53,92 @@ void WorldObject::PhysicsUpdate(float deltaTime)
 void WorldObject::DetectCollisionExits()
 {
   // For each of last frame's collisions
-  for (auto [collisionHash, collision] : lastFrameCollisions)
+  for (auto &[collisionHash, collision] : lastFrameCollisions)
   {
     // Check colliders
     // If it hasn't happened this frame
-    if (collision.weakOther.expired() == false &&
-        collision.weakSource.expired() == false &&
+    if (collision.GetOther() != nullptr &&
+        collision.GetSource() != nullptr &&
         frameCollisions.count(collisionHash) == 0)
       // Raise exit
       OnCollisionExit(collision);
   }
 
   // For each of last frame's triggers
-  for (auto [triggerHash, triggerData] : lastFrameTriggers)
+  for (auto &[triggerHash, triggerData] : lastFrameTriggers)
   {
     // Check colliders
     // If it hasn't happened this frame
-    if (triggerData.weakOther.expired() == false &&
-        triggerData.weakSource.expired() == false &&
+    if (triggerData.GetOther() != nullptr &&
+        triggerData.GetSource() != nullptr &&
         frameTriggers.count(triggerHash) == 0)
       // Raise exit
       OnTriggerCollisionExit(triggerData);
   }
 
-  // Update registers
-  lastFrameCollisions = frameCollisions;
-  lastFrameTriggers = frameTriggers;
+  // Update registers (swapping keeps the maps' buckets around instead of reallocating them)
+  lastFrameCollisions.swap(frameCollisions);
+  lastFrameTriggers.swap(frameTriggers);
   frameCollisions.clear();
   frameTriggers.clear();
 }
 
-void WorldObject::HandleColliderDestruction(shared_ptr<Collider> collider)
+void WorldObject::HandleColliderDestruction(const Collider &collider)
 {
   // Trigger collisions to exit
   unordered_map<size_t, TriggerCollisionData> exitTriggers;
 
-  // For each of this frame's triggers
-  for (auto [triggerHash, triggerData] : frameTriggers)
+  // Collects the triggers whose source is this collider
+  auto collectTriggers = [&](const decltype(frameTriggers) &triggers)
   {
-    // Raise if the source collider is this one
-    IF_LOCK(triggerData.weakSource, source)
-    IF_LOCK(triggerData.weakOther, other)
-    if (source->id == collider->id)
-      exitTriggers[triggerHash] = triggerData;
-  }
+    for (auto &[triggerHash, triggerData] : triggers)
+      if (triggerData.source == collider.handle && triggerData.GetOther() != nullptr)
+        exitTriggers[triggerHash] = triggerData;
+  };
 
-  // For each of last frame's triggers
-  for (auto [triggerHash, triggerData] : lastFrameTriggers)
-  {
-    // Raise if the source collider is this one
-    IF_LOCK(triggerData.weakSource, source)
-    IF_LOCK(triggerData.weakOther, other)
-    if (source->id == collider->id)
-      exitTriggers[triggerHash] = triggerData;
-  }
+  collectTriggers(frameTriggers);
+  collectTriggers(lastFrameTriggers);
 
   // Exit all collected triggers
-  for (auto [triggerHash, triggerData] : exitTriggers)
+  for (auto &[triggerHash, triggerData] : exitTriggers)
   {
-    LOCK(triggerData.weakOther, other);
+    auto &other = triggerData.RequireOther();
 
     OnTriggerCollisionExit(triggerData);
 
     auto otherData = triggerData;
-    otherData.weakOther = triggerData.weakSource;
-    otherData.weakSource = triggerData.weakOther;
+    otherData.other = triggerData.source;
+    otherData.source = triggerData.other;
 
-    other->OnTriggerCollisionExit(otherData);
+    other.OnTriggerCollisionExit(otherData);
   }
 
   // Collisions to exit
   unordered_map<size_t, Collision::Data> exitCollisions;
 
-  // For each of this frame's collisions
-  for (auto [collisionHash, collisionData] : frameCollisions)
+  // Collects the collisions whose source is this collider
+  auto collectCollisions = [&](const decltype(frameCollisions) &collisions)
   {
-    // Raise if the source collider is this one
-    IF_LOCK(collisionData.weakSource, source)
-    IF_LOCK(collisionData.weakOther, other)
-    if (source->id == collider->id)
-      exitCollisions[collisionHash] = collisionData;
-  }
+    for (auto &[collisionHash, collisionData] : collisions)
+      if (collisionData.source == collider.handle && collisionData.GetOther() != nullptr)
+        exitCollisions[collisionHash] = collisionData;
+  };
 
-  // For each of last frame's collisions
-  for (auto [collisionHash, collisionData] : lastFrameCollisions)
-  {
-    // Raise if the source collider is this one
-    IF_LOCK(collisionData.weakSource, source)
-    IF_LOCK(collisionData.weakOther, other)
-    if (source->id == collider->id)
-      exitCollisions[collisionHash] = collisionData;
-  }
+  collectCollisions(frameCollisions);
+  collectCollisions(lastFrameCollisions);
 
   // Exit all collected collisions
-  for (auto [collisionHash, collisionData] : exitCollisions)
+  for (auto &[collisionHash, collisionData] : exitCollisions)
   {
-    LOCK(collisionData.weakOther, other);
+    auto &other = collisionData.RequireOther();
 
     OnCollisionExit(collisionData);
 
     auto otherData = collisionData;
-    otherData.weakOther = collisionData.weakSource;
-    otherData.weakSource = collisionData.weakOther;
+    otherData.other = collisionData.source;
+    otherData.source = collisionData.other;
 
-    other->OnCollisionExit(otherData);
+    other.OnCollisionExit(otherData);
   }
 }
 
@@ -195,6 +163,12 @@ std::shared_ptr<WorldObject> WorldObject::InternalGetWorldParent() const
   return RequirePointerCast<WorldObject>(InternalGetParentNoException());
 }
 
+WorldObject &WorldObject::ResolveWorldParent() const
+{
+  // A world object's parent is always a world object
+  return static_cast<WorldObject &>(InternalResolveParent());
+}
+
 shared_ptr<WorldObject> WorldObject::GetParent() const
 {
   return IsRoot() ? nullptr : InternalGetWorldParent();
@@ -214,6 +188,7 @@ auto WorldObject::UnlinkParent() -> unordered_map<int, weak_ptr<WorldObject>>::i
   if (iterator != parent->children.end())
     iterator = parent->children.erase(iterator);
   weakParent.reset();
+  parentHandle = Handle();
 
   return iterator;
 }
@@ -231,6 +206,7 @@ void WorldObject::SetParent(shared_ptr<WorldObject> newParent, std::shared_ptr<W
 
   // Set new parent
   weakParent = newParent;
+  parentHandle = newParent->handle;
   newParent->children[id] = ownPointer;
 
   // Inherit this new parent's layer if necessary
@@ -249,13 +225,13 @@ Vector2 WorldObject::GetPosition()
   if (IsRoot())
     return localPosition;
 
-  return InternalGetWorldParent()->GetPosition() + localPosition;
+  return ResolveWorldParent().GetPosition() + localPosition;
 }
 void WorldObject::SetPosition(const Vector2 newPosition)
 {
   if (IsRoot())
     localPosition = newPosition;
-  localPosition = newPosition - InternalGetWorldParent()->GetPosition();
+  localPosition = newPosition - ResolveWorldParent().GetPosition();
 }
 
 void WorldObject::Translate(const Vector2 translation)
@@ -268,14 +244,14 @@ Vector2 WorldObject::GetScale()
 {
   if (IsRoot())
     return localScale;
-  return InternalGetWorldParent()->GetScale() * localScale;
+  return ResolveWorldParent().GetScale() * localScale;
 }
 void WorldObject::SetScale(const Vector2 newScale)
 {
   if (IsRoot())
     localScale = newScale;
 
-  Vector2 parentScale{InternalGetWorldParent()->GetScale()};
+  Vector2 parentScale{ResolveWorldParent().GetScale()};
 
   Assert(parentScale.x > 0 && parentScale.y > 0, "Parent scale had a 0 is invalid");
 
@@ -287,13 +263,13 @@ double WorldObject::GetRotation()
 {
   if (IsRoot())
     return localRotation;
-  return InternalGetWorldParent()->GetRotation() + localRotation;
+  return ResolveWorldParent().GetRotation() + localRotation;
 }
 void WorldObject::SetRotation(const double newRotation)
 {
   if (IsRoot())
     localRotation = newRotation;
-  localRotation = newRotation - InternalGetWorldParent()->GetRotation();
+  localRotation = newRotation - ResolveWorldParent().GetRotation();
 }
 
 shared_ptr<WorldObject> WorldObject::CreateChild(string name)
@@ -351,69 +327,85 @@ auto WorldObject::DestroySelf() -> std::unordered_map<int, std::weak_ptr<WorldOb
   return iterator;
 }
 
-void WorldObject::OnCollision(Collision::Data collisionData)
+void WorldObject::OnCollision(const Collision::Data &collisionData)
 {
   // Register collision
   frameCollisions[collisionData.GetHash()] = collisionData;
 
   // Alert all components
-  for (auto [componentId, component] : components)
-    RequirePointerCast<WorldComponent>(component)->OnCollision(collisionData);
+  for (auto &[componentId, component] : components)
+  {
+    PROFILE_COMPONENT(*component, Collision);
+    static_cast<WorldComponent &>(*component).OnCollision(collisionData);
+  }
 }
 
-void WorldObject::OnCollisionEnter(Collision::Data collisionData)
+void WorldObject::OnCollisionEnter(const Collision::Data &collisionData)
 {
   // Alert all components
-  for (auto [componentId, component] : components)
-    RequirePointerCast<WorldComponent>(component)->OnCollisionEnter(collisionData);
+  for (auto &[componentId, component] : components)
+  {
+    PROFILE_COMPONENT(*component, Collision);
+    static_cast<WorldComponent &>(*component).OnCollisionEnter(collisionData);
+  }
 }
 
-void WorldObject::OnCollisionExit(Collision::Data collisionData)
+void WorldObject::OnCollisionExit(const Collision::Data &collisionData)
 {
   // Alert all components
-  for (auto [componentId, component] : components)
-    RequirePointerCast<WorldComponent>(component)->OnCollisionExit(collisionData);
+  for (auto &[componentId, component] : components)
+  {
+    PROFILE_COMPONENT(*component, Collision);
+    static_cast<WorldComponent &>(*component).OnCollisionExit(collisionData);
+  }
 }
 
-void WorldObject::OnTriggerCollision(TriggerCollisionData triggerData)
+void WorldObject::OnTriggerCollision(const TriggerCollisionData &triggerData)
 {
   // Register trigger
   frameTriggers[triggerData.GetHash()] = triggerData;
 
   // Alert all components
-  for (auto [componentId, component] : components)
-    RequirePointerCast<WorldComponent>(component)->OnTriggerCollision(triggerData);
+  for (auto &[componentId, component] : components)
+  {
+    PROFILE_COMPONENT(*component, Collision);
+    static_cast<WorldComponent &>(*component).OnTriggerCollision(triggerData);
+  }
 }
 
-void WorldObject::OnTriggerCollisionEnter(TriggerCollisionData triggerData)
+void WorldObject::OnTriggerCollisionEnter(const TriggerCollisionData &triggerData)
 {
   // Alert all components
-  for (auto [componentId, component] : components)
-    RequirePointerCast<WorldComponent>(component)->OnTriggerCollisionEnter(triggerData);
+  for (auto &[componentId, component] : components)
+  {
+    PROFILE_COMPONENT(*component, Collision);
+    static_cast<WorldComponent &>(*component).OnTriggerCollisionEnter(triggerData);
+  }
 }
 
-void WorldObject::OnTriggerCollisionExit(TriggerCollisionData triggerData)
+void WorldObject::OnTriggerCollisionExit(const TriggerCollisionData &triggerData)
 {
   // Alert all components
-  for (auto [componentId, component] : components)
-    RequirePointerCast<WorldComponent>(component)->OnTriggerCollisionExit(triggerData);
+  for (auto &[componentId, component] : components)
+  {
+    PROFILE_COMPONENT(*component, Collision);
+    static_cast<WorldComponent &>(*component).OnTriggerCollisionExit(triggerData);
+  }
 }
 
-bool WorldObject::IsDescendantOf(std::shared_ptr<WorldObject> other) const
+bool WorldObject::IsDescendantOf(const WorldObject &other) const
 {
-  if (*this == *other)
-    return true;
+  // Walk up the hierarchy, root included
+  for (auto object = this; object != nullptr; object = object->IsRoot() ? nullptr : Resolve<WorldObject>(object->parentHandle))
+    if (*object == other)
+      return true;
 
-  if (GetParent() == nullptr)
-    return false;
-
-  return GetParent()->IsDescendantOf(other);
+  return false;
 }
 
-bool WorldObject::SameLineage(
-    std::shared_ptr<WorldObject> first, std::shared_ptr<WorldObject> second)
+bool WorldObject::SameLineage(const WorldObject &first, const WorldObject &second)
 {
-  return first->IsDescendantOf(second) || second->IsDescendantOf(first);
+  return first.IsDescendantOf(second) || second.IsDescendantOf(first);
 }
 
 void WorldObject::SetPhysicsLayer(PhysicsLayer newLayer)
@@ -426,68 +418,56 @@ void WorldObject::SetPhysicsLayer(PhysicsLayer newLayer)
 
 PhysicsLayer WorldObject::GetPhysicsLayer() { return physicsLayer; }
 
-bool WorldObject::IsCollidingWith(shared_ptr<Collider> collider)
+bool WorldObject::IsCollidingWith(const Collider &collider)
 {
-  for (auto [collisionHash, collision] : frameCollisions)
-    IF_LOCK(collision.weakOther, other)
-    {
-      if (other->id == collider->id)
-        return true;
-    }
+  for (auto &[collisionHash, collision] : frameCollisions)
+    if (collision.other == collider.handle)
+      return true;
 
   return false;
 }
 
-bool WorldObject::WasCollidingWith(shared_ptr<Collider> collider)
+bool WorldObject::WasCollidingWith(const Collider &collider)
 {
-  for (auto [collisionHash, collision] : lastFrameCollisions)
-    IF_LOCK(collision.weakOther, other)
-    {
-      if (other->id == collider->id)
-        return true;
-    }
+  for (auto &[collisionHash, collision] : lastFrameCollisions)
+    if (collision.other == collider.handle)
+      return true;
 
   return false;
 }
 
-bool WorldObject::IsTriggerCollidingWith(shared_ptr<Collider> collider)
+bool WorldObject::IsTriggerCollidingWith(const Collider &collider)
 {
-  for (auto [triggerHash, triggerData] : frameTriggers)
-    IF_LOCK(triggerData.weakOther, other)
-    {
-      if (other->id == collider->id)
-        return true;
-    }
+  for (auto &[triggerHash, triggerData] : frameTriggers)
+    if (triggerData.other == collider.handle)
+      return true;
 
   return false;
 }
 
-bool WorldObject::WasTriggerCollidingWith(shared_ptr<Collider> collider)
+bool WorldObject::WasTriggerCollidingWith(const Collider &collider)
 {
-  for (auto [triggerHash, triggerData] : lastFrameTriggers)
-    IF_LOCK(triggerData.weakOther, other)
-    {
-      if (other->id == collider->id)
-        return true;
-    }
+  for (auto &[triggerHash, triggerData] : lastFrameTriggers)
+    if (triggerData.other == collider.handle)
+      return true;
 
   return false;
 }
 
-bool WorldObject::CollisionDealtWith(Collision::Data collisionData)
+bool WorldObject::CollisionDealtWith(const Collision::Data &collisionData)
 {
   return frameCollisions.count(collisionData.GetHash()) > 0;
 }
-bool WorldObject::CollisionDealtWithLastFrame(Collision::Data collisionData)
+bool WorldObject::CollisionDealtWithLastFrame(const Collision::Data &collisionData)
 {
   return lastFrameCollisions.count(collisionData.GetHash()) > 0;
 }
 
-bool WorldObject::TriggerCollisionDealtWith(TriggerCollisionData triggerData)
+bool WorldObject::TriggerCollisionDealtWith(const TriggerCollisionData &triggerData)
 {
   return frameTriggers.count(triggerData.GetHash()) > 0;
 }
-bool WorldObject::TriggerCollisionDealtWithLastFrame(TriggerCollisionData triggerData)
+bool WorldObject::TriggerCollisionDealtWithLastFrame(const TriggerCollisionData &triggerData)
 {
   return lastFrameTriggers.count(triggerData.GetHash()) > 0;
 }
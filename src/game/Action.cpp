@@ -57,11 +57,11 @@ void AnimationAction::Trigger(WorldObject &target, shared_ptr<CharacterState> ac
   // In case this is an inner loop animation
   if (auto innerLoopAnimation = dynamic_pointer_cast<InnerLoopAnimation>(animation); innerLoopAnimation != nullptr)
     // Register the stop callback to sequence end
-    innerLoopAnimation->OnSequenceStop.AddListener("parent-action-cleanup", removeStateCallback);
+    innerLoopAnimation->OnSequenceStop.AddListener(removeStateCallback);
 
   // Otherwise, add it on animation stop
   else
-    animation->OnStop.AddListener("parent-action-cleanup", removeStateCallback);
+    animation->OnStop.AddListener(removeStateCallback);
 
   // Start this animation
   animator->Play(animation, true);
@@ -83,7 +83,7 @@ void Dash::Trigger(WorldObject &target, shared_ptr<CharacterState> dashState)
   // Get recover frame
   int recoverFrame = target.RequireComponent<Character>()->GetDashRecoverFrame();
 
-  animation->GetFrame(recoverFrame).AddCallback(stateSwitchCallback);
+  animation->AddCallback(recoverFrame, stateSwitchCallback);
 
   // On stop, ensure both states have been removed
   auto stopCallback = [dashStateId, recoveringStateId, weakStateManager]()
@@ -94,7 +94,7 @@ void Dash::Trigger(WorldObject &target, shared_ptr<CharacterState> dashState)
       stateManager->RemoveState(recoveringStateId);
     }
   };
-  animation->OnStop.AddListener("action-cleanup", stopCallback);
+  animation->OnStop.AddListener(stopCallback);
 
   // Start this animation
   animator->Play(animation);
@@ -189,7 +189,7 @@ void Riposte::Trigger(WorldObject &target, shared_ptr<CharacterState> actionStat
       stateManager->RemoveState(stateId);
     }
   };
-  animation->OnStop.AddListener("parent-action-cleanup", removeStateCallback);
+  animation->OnStop.AddListener(removeStateCallback);
 
   // Start this animation
   animator->Play(animation, true);
@@ -225,7 +225,7 @@ void LandingAttack::Trigger(WorldObject &target, shared_ptr<CharacterState> acti
       stateManager->RemoveState(stateId);
     }
   };
-  animation->OnStop.AddListener("parent-action-cleanup", removeStateCallback);
+  animation->OnStop.AddListener(removeStateCallback);
 
   // Start this animation
   animator->Play(animation, true);
@@ -33,6 +33,10 @@ void ArenaPiaui::InitializeArena()
   // Give background a parallax
   background->SetParallax(0.5, maxCameraSize);
 
+  // Neither of them move, so they can be drawn from caches
+  GetScene()->CacheLayer(RenderLayer::Background, background->GetParallax());
+  GetScene()->CacheLayer(RenderLayer::Platforms);
+
   // SAFENET
   // GetScene()->Instantiate("safenet", ObjectRecipes::Platform({20, 2}), Vector2{8, 0})->SetParent(worldObject.GetShared());
 
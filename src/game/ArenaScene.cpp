@@ -26,6 +26,23 @@ static const float initialCharactersDistance{3};
 
 string ArenaScene::GetName() const { return "ArenaScene"; }
 
+void ArenaScene::DeclareAssets(AssetManifest &manifest)
+{
+  // Arena
+  manifest.images.insert("./assets/sprites/piaui/platforms.png");
+  manifest.images.insert("./assets/sprites/piaui/background.png");
+
+  // Player UI
+  manifest.images.insert("./assets/sprites/badge.png");
+  manifest.images.insert("./assets/sprites/life.png");
+
+  // Hits & falls
+  for (int punch{2}; punch <= 9; punch++)
+    manifest.sounds.insert("./assets/sounds/battle/punches/0" + to_string(punch) + ".mp3");
+
+  manifest.sounds.insert("./assets/sounds/battle/fall-burn.mp3");
+}
+
 void ArenaScene::OnUpdate(float)
 {
 }
@@ -45,7 +62,7 @@ void ArenaScene::InitializeObjects()
   auto mainCamera = Instantiate("MainCamera", ObjectRecipes::Camera())->GetComponent<Camera>();
   mainCamera->worldObject.SetParent(mainParent);
   auto sound = mainCamera->worldObject.AddComponent<Sound>();
-  sound->AddAudio(SOUND_BACKGROUND, "./assets/sounds/battle/boteco-background.mp3");
+  sound->AddAudio(SOUND_BACKGROUND, "./assets/sounds/battle/boteco-background.mp3", SoundCategory::Ambience, 2);
 
   // Give it behavior
   mainCamera->gameObject.AddComponent<CameraBehavior>(charactersParent);
@@ -30,10 +30,10 @@ ArenaUIAnimation::ArenaUIAnimation(GameObject &associatedObject)
 {
   LOCK(weakSound, sound);
 
-  sound->AddAudio(SOUND_COUNT_1, "./assets/sounds/battle/counting/count1.mp3");
-  sound->AddAudio(SOUND_COUNT_2, "./assets/sounds/battle/counting/count2.mp3");
-  sound->AddAudio(SOUND_COUNT_3, "./assets/sounds/battle/counting/count3.mp3");
-  sound->AddAudio(SOUND_FIRE, "./assets/sounds/battle/counting/gunshot.mp3");
+  sound->AddAudio(SOUND_COUNT_1, "./assets/sounds/battle/counting/count1.mp3", SoundCategory::Interface, 1);
+  sound->AddAudio(SOUND_COUNT_2, "./assets/sounds/battle/counting/count2.mp3", SoundCategory::Interface, 1);
+  sound->AddAudio(SOUND_COUNT_3, "./assets/sounds/battle/counting/count3.mp3", SoundCategory::Interface, 1);
+  sound->AddAudio(SOUND_FIRE, "./assets/sounds/battle/counting/gunshot.mp3", SoundCategory::Interface, 1);
 }
 
 void ArenaUIAnimation::Update(float deltaTime)
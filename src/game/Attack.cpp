@@ -29,10 +29,10 @@ void Attack::Land(shared_ptr<CharacterController> targetController)
 
 void Attack::OnTriggerCollision(TriggerCollisionData trigger)
 {
-  LOCK(trigger.weakOther, other);
+  auto &other = trigger.RequireOther();
 
   // Get other object
-  auto otherObject = other->GetOwner();
+  auto otherObject = other.GetOwner();
 
   // Check if ignored
   if (ignoredObjects.count(otherObject->id) > 0)
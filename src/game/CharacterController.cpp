@@ -90,8 +90,8 @@ void CharacterController::HandleMovementAnimation()
 void CharacterController::Start()
 {
   // Enable control on battle start
-  GetScene()->RequireFindComponent<Arena>()->OnBattleStart.AddListener("enable-character-control-" + to_string(id), [this]()
-                                                                       { controlDisabled = false; });
+  battleStartSubscription = GetScene()->RequireFindComponent<Arena>()->OnBattleStart.Subscribe([this]()
+                                                                                              { controlDisabled = false; });
 
   // For now, there must be player input. In the future there may be an AIInput instead
   auto inputs = worldObject.GetComponents<PlayerInput>();
@@ -103,59 +103,59 @@ void CharacterController::Start()
     auto weakInput = weak_ptr(input);
 
     // Subscribe to movement
-    input->OnMoveDirection.AddListener("character-controller", [this](float direction)
+    input->OnMoveDirection.AddListener([this](float direction)
                                        { Dispatch<Actions::Move>(false, true, direction); });
 
     // Make sure to dispatch another movement if movement key is being held when character becomes idle
-    stateManager.OnEnterIdle.AddListener("check-if-moving", [this, weakInput]()
+    stateManager.OnEnterIdle.AddListener([this, weakInput]()
                                          { if (auto input = weakInput.lock(); input && input->GetCurrentMoveDirection() != 0)
                                     Dispatch<Actions::Move>(false, true, input->GetCurrentMoveDirection()); });
 
     // Subscribe to jumps
     // Make it a friend of moving
-    input->OnJump.AddListener("character-controller", [this]()
+    input->OnJump.AddListener([this]()
                               { if (movement.CanJump() ) Dispatch<Actions::Jump>(true, true); });
 
     // Fast falling isn't an action
-    input->OnFastFall.AddListener("character-controller", [this]()
+    input->OnFastFall.AddListener([this]()
                                   { movement.FallFast(); });
-    input->OnFastFallStop.AddListener("character-controller", [this]()
+    input->OnFastFallStop.AddListener([this]()
                                       { movement.StopFallFast(); });
 
     // Land behavior
-    movement.OnLand.AddListener("character-controller", [this]()
+    movement.OnLand.AddListener([this]()
                                 { OnLand(); });
 
     //  Dash
-    input->OnDash.AddListener("character-controller", [this](Vector2 direction)
+    input->OnDash.AddListener([this](Vector2 direction)
                               { DispatchDash(direction); });
 
     // Attacks
-    input->OnAttackNeutral.AddListener("character-controller", [this]()
+    input->OnAttackNeutral.AddListener([this]()
                                        { Dispatch<Actions::Neutral>(true, true); });
-    input->OnAttackHorizontal.AddListener("character-controller", [this]()
+    input->OnAttackHorizontal.AddListener([this]()
                                           { Dispatch<Actions::Horizontal>(true, true); });
-    input->OnAttackUp.AddListener("character-controller", [this]()
+    input->OnAttackUp.AddListener([this]()
                                   { Dispatch<Actions::Up>(true, true); });
 
     // Air attacks
-    input->OnAirHorizontal.AddListener("character-controller", [this]()
+    input->OnAirHorizontal.AddListener([this]()
                                        { Dispatch<Actions::AirHorizontal>(true, true); });
-    input->OnAirUp.AddListener("character-controller", [this]()
+    input->OnAirUp.AddListener([this]()
                                { Dispatch<Actions::AirUp>(true, true); });
-    input->OnAirDown.AddListener("character-controller", [this]()
+    input->OnAirDown.AddListener([this]()
                                  { Dispatch<Actions::AirDown>(true, true); });
 
     // Specials
-    input->OnSpecialNeutral.AddListener("character-controller", [this]()
+    input->OnSpecialNeutral.AddListener([this]()
                                         { Dispatch<Actions::SpecialNeutral>(true, true); });
-    input->OnSpecialHorizontal.AddListener("character-controller", [this]()
+    input->OnSpecialHorizontal.AddListener([this]()
                                            { Dispatch<Actions::SpecialHorizontal>(true, true); });
 
     // Raise release events on states
-    input->OnReleaseAttack.AddListener("character-controller", [this]()
+    input->OnReleaseAttack.AddListener([this]()
                                        { AnnounceInputRelease(ATTACKING_STATE); });
-    input->OnReleaseSpecial.AddListener("character-controller", [this]()
+    input->OnReleaseSpecial.AddListener([this]()
                                         { AnnounceInputRelease(SPECIAL_ATTACKING_STATE); });
   }
 }
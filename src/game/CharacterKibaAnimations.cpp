@@ -34,17 +34,21 @@ vector<AnimationFrame> Run::InitializeFrames()
   stepParticles.lifetime = {0.1, 0.5};
   stepParticles.speed = {0.7, 1};
 
-  auto sound1 = Sample(vector{SOUND_STEP_1, SOUND_STEP_2, SOUND_STEP_3, SOUND_STEP_4});
-  auto sound2 = Sample(vector{SOUND_STEP_1, SOUND_STEP_2, SOUND_STEP_3, SOUND_STEP_4});
+  vector<const char *> steps{SOUND_STEP_1, SOUND_STEP_2, SOUND_STEP_3, SOUND_STEP_4};
 
   auto sound = animator.worldObject.RequireComponent<Sound>();
-  sound->AddAudio(sound1, "./assets/sounds/battle/steps/" + string(sound1) + ".mp3");
-  sound->AddAudio(sound2, "./assets/sounds/battle/steps/" + string(sound2) + ".mp3");
+
+  for (auto step : steps)
+    sound->AddAudio(step, "./assets/sounds/battle/steps/" + string(step) + ".mp3");
+
+  // These frames are shared by every run, so pick each step's sound as it's taken
+  auto playStep = [steps](WorldObject &target)
+  { target.RequireComponent<Sound>()->Play(Sample(steps)); };
 
   frames[0].AddCallback(ParticleFXCallback(frames[0].GetSprite(), {31, 35}, 0.01, 0.01, stepParticles, 1));
-  frames[0].AddCallback(SFXCallback(sound1));
+  frames[0].AddCallback(playStep);
   frames[3].AddCallback(ParticleFXCallback(frames[3].GetSprite(), {195 - 324 / 2, 35}, 0.01, 0.01, stepParticles, 1));
-  frames[3].AddCallback(SFXCallback(sound2));
+  frames[3].AddCallback(playStep);
 
   return frames;
 }
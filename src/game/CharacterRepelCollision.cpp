@@ -24,8 +24,8 @@ void CharacterRepelCollision::OnTriggerCollision(TriggerCollisionData triggerDat
       stateManager->HasState(SPECIAL_ATTACKING_STATE))
     return;
 
-  LOCK(triggerData.weakOther, other);
-  LOCK(other->rigidbodyWeak, otherBody);
+  auto &other = triggerData.RequireOther();
+  LOCK(other.rigidbodyWeak, otherBody);
 
   // Slide away from it
   SlideAwayFrom(otherBody);
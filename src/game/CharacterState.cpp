@@ -21,7 +21,7 @@ void CharacterState::ReleaseActionInput()
   OnActionInputRelease.Invoke();
 }
 
-bool CharacterState::RemoveRequested(std::shared_ptr<CharacterStateManager> stateManager)
+bool CharacterState::RemoveRequested(CharacterStateManager &stateManager)
 {
   if (removeCondition == nullptr)
     return false;
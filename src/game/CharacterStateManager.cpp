@@ -20,18 +20,14 @@ CharacterStateManager::CharacterStateManager(GameObject &associatedObject)
 
 void CharacterStateManager::StartBouncing()
 {
-  LOCK(weakBody, body);
-
   // Add elasticity to bounce
-  body->elasticity = bounceElasticity;
+  RequireBody().elasticity = bounceElasticity;
 }
 
 void CharacterStateManager::StopBouncing()
 {
-  LOCK(weakBody, body);
-
   // Remove elasticity
-  body->elasticity = 0;
+  RequireBody().elasticity = 0;
 }
 
 void CharacterStateManager::PhysicsUpdate(float)
@@ -40,10 +36,8 @@ void CharacterStateManager::PhysicsUpdate(float)
   if (IsBouncing() == false)
     return;
 
-  LOCK(weakBody, body);
-
   // Check if speed is low enough
-  if (body->velocity.SqrMagnitude() < minBounceSpeed * minBounceSpeed)
+  if (RequireBody().velocity.SqrMagnitude() < minBounceSpeed * minBounceSpeed)
     StopBouncing();
 }
 
@@ -64,18 +58,16 @@ void CharacterStateManager::Update(float deltaTime)
 
 void CharacterStateManager::Awake()
 {
-  weakBody = worldObject.RequireComponent<Rigidbody>();
+  bodyHandle = worldObject.RequireComponent<Rigidbody>()->handle;
 
   auto bounceIfTooFast = [this](Damage, float)
   {
-    LOCK(weakBody, body);
-
     // Check if velocity is high enough
-    if (body->velocity.SqrMagnitude() >= minBounceSpeed * minBounceSpeed)
+    if (RequireBody().velocity.SqrMagnitude() >= minBounceSpeed * minBounceSpeed)
       StartBouncing();
   };
 
-  worldObject.RequireComponent<Heat>()->OnTakeDamage.AddListener("start-bounce", bounceIfTooFast);
+  worldObject.RequireComponent<Heat>()->OnTakeDamage.AddListener(bounceIfTooFast);
 }
 
 void CharacterStateManager::HandleQueuedAction(float deltaTime)
@@ -146,7 +138,7 @@ void CharacterStateManager::QueueAction(shared_ptr<Action> action)
 bool CharacterStateManager::CanPerform(shared_ptr<Action> action)
 {
   // Check if this state blocks the incoming action
-  auto stateBlocksAction = [action](shared_ptr<CharacterState> state)
+  auto stateBlocksAction = [action](const shared_ptr<CharacterState> &state)
   {
     return (
         // It must have higher priority
@@ -216,7 +208,7 @@ void CharacterStateManager::Perform(shared_ptr<Action> action, bool canDelay)
 void CharacterStateManager::RemoveState(string name, bool interruption)
 {
   // Find this state
-  auto stateIterator = find_if(states.begin(), states.end(), [name](shared_ptr<CharacterState> state)
+  auto stateIterator = find_if(states.begin(), states.end(), [name](const shared_ptr<CharacterState> &state)
                                { return state->name == name; });
 
   //  If it's not there, stop
@@ -230,7 +222,7 @@ void CharacterStateManager::RemoveState(string name, bool interruption)
 void CharacterStateManager::RemoveState(unsigned id, bool interruption)
 {
   // Find this state
-  auto stateIterator = find_if(states.begin(), states.end(), [id](shared_ptr<CharacterState> state)
+  auto stateIterator = find_if(states.begin(), states.end(), [id](const shared_ptr<CharacterState> &state)
                                { return state->id == id; });
 
   //  If it's not there, stop
@@ -247,7 +239,7 @@ auto CharacterStateManager::RemoveState(decltype(states)::iterator stateIterator
 
   // Call it's stop callback if necessary
   if (state->onRemove != nullptr)
-    state->onRemove(GetSharedCasted());
+    state->onRemove(*this);
 
   if (state->parentAction != nullptr)
     state->parentAction->StopHook(worldObject, state);
@@ -269,7 +261,7 @@ auto CharacterStateManager::RemoveState(decltype(states)::iterator stateIterator
 void CharacterStateManager::AddState(shared_ptr<CharacterState> newState)
 {
   // If it's already there, remove it first
-  auto stateIterator = find_if(states.begin(), states.end(), [newState](shared_ptr<CharacterState> state)
+  auto stateIterator = find_if(states.begin(), states.end(), [newState](const shared_ptr<CharacterState> &state)
                                { return state->name == newState->name; });
 
   if (stateIterator != states.end())
@@ -280,12 +272,12 @@ void CharacterStateManager::AddState(shared_ptr<CharacterState> newState)
 
   // Trigger it's callback
   if (newState->onAdd != nullptr)
-    newState->onAdd(GetSharedCasted());
+    newState->onAdd(*this);
 }
 
 bool CharacterStateManager::HasState(string stateName)
 {
-  return find_if(states.begin(), states.end(), [stateName](shared_ptr<CharacterState> state)
+  return find_if(states.begin(), states.end(), [&stateName](const shared_ptr<CharacterState> &state)
                  { return state->name == stateName; }) != states.end();
 }
 
@@ -294,21 +286,17 @@ shared_ptr<Action> CharacterStateManager::GetQueuedAction() const { return queue
 bool CharacterStateManager::HasControl() const
 {
   // If any state loses control, no control
-  return all_of(states.begin(), states.end(), [](shared_ptr<CharacterState> state)
+  return all_of(states.begin(), states.end(), [](const shared_ptr<CharacterState> &state)
                 { return state->losesControl == false; });
 }
 
 void CharacterStateManager::HandleStateExpiration()
 {
-  auto shared = GetSharedCasted();
-
   auto stateIterator = states.begin();
   while (stateIterator != states.end())
   {
-    auto state = *stateIterator;
-
     // Remove it if requested
-    if (state->RemoveRequested(shared))
+    if ((*stateIterator)->RemoveRequested(*this))
       stateIterator = RemoveState(stateIterator, false);
 
     // Otherwise, cary on
@@ -319,10 +307,17 @@ void CharacterStateManager::HandleStateExpiration()
 
 bool CharacterStateManager::IsBouncing() const
 {
-  LOCK(weakBody, body);
-
   // If has elasticity, it's bouncing
-  return body->elasticity != 0;
+  return RequireBody().elasticity != 0;
+}
+
+Rigidbody &CharacterStateManager::RequireBody() const
+{
+  auto body = Resolve<Rigidbody>(bodyHandle);
+
+  Assert(body != nullptr, "Character state manager's body was already destroyed");
+
+  return *body;
 }
 
 shared_ptr<CharacterStateManager> CharacterStateManager::GetSharedCasted() const
@@ -62,26 +62,26 @@ shared_ptr<CharacterState> CharacterStateRecipes::Stunned(shared_ptr<Action> act
 
   state->losesControl = true;
 
-  state->removeCondition = [](shared_ptr<CharacterStateManager> stateManager)
+  state->removeCondition = [](CharacterStateManager &stateManager)
   {
     // Check if stun time is up
-    if (stateManager->worldObject.timer.Get(STUN_DURATION_TIMER) < 0)
+    if (stateManager.worldObject.timer.Get(STUN_DURATION_TIMER) < 0)
       return false;
 
     // Check if velocity is low enough
-    return stateManager->worldObject.RequireComponent<Rigidbody>()->velocity.SqrMagnitude() <=
+    return stateManager.worldObject.RequireComponent<Rigidbody>()->velocity.SqrMagnitude() <=
            stunRecoverSpeed * stunRecoverSpeed;
   };
 
   // Toggle air friction
-  state->onAdd = [](shared_ptr<CharacterStateManager> stateManager)
+  state->onAdd = [](CharacterStateManager &stateManager)
   {
-    stateManager->worldObject.RequireComponent<Rigidbody>()->airFriction = stunAirFriction;
+    stateManager.worldObject.RequireComponent<Rigidbody>()->airFriction = stunAirFriction;
   };
 
-  state->onRemove = [](shared_ptr<CharacterStateManager> stateManager)
+  state->onRemove = [](CharacterStateManager &stateManager)
   {
-    stateManager->worldObject.RequireComponent<Rigidbody>()->airFriction = 0;
+    stateManager.worldObject.RequireComponent<Rigidbody>()->airFriction = 0;
   };
 
   return state;
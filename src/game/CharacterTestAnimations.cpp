@@ -154,12 +154,14 @@ vector<AnimationFrame> SpecialHorizontal::InitializeFrames()
   frames[1].SetDuration(0.2);
 
   // Add shoot frame
-  auto shoot = [this](WorldObject &target)
+  auto shoot = [](WorldObject &target, Animation &animation)
   {
+    auto &shooter = static_cast<SpecialHorizontal &>(animation);
+
     float mirrorFactor = GetSign(target.GetScale().x);
 
     // Get shoot position
-    Vector2 shotPosition = GlobalVirtualPixelPosition({10, 3});
+    Vector2 shotPosition = shooter.GlobalVirtualPixelPosition({10, 3});
 
     // Add smoke
     ParticleEmissionParameters smoke;
@@ -183,9 +185,9 @@ vector<AnimationFrame> SpecialHorizontal::InitializeFrames()
 
     ParticleFX::EffectAt(shotPosition, 0.01, 0.01, sparks, 1);
 
-    auto projectile = animator.GetScene()->Instantiate(
+    auto projectile = shooter.animator.GetScene()->Instantiate(
         "Projectile",
-        ObjectRecipes::Projectile({8 * mirrorFactor, 0}, animator.worldObject.GetShared(), {0, 0}),
+        ObjectRecipes::Projectile({8 * mirrorFactor, 0}, shooter.animator.worldObject.GetShared(), {0, 0}),
         shotPosition);
 
     projectile->localScale = {mirrorFactor, 1};
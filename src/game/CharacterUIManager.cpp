@@ -31,7 +31,7 @@ void CharacterUIManager::Start()
   weakLifeContainer = RequirePointerCast<UIContainer>(uiContainer.RequireChild(CHARACTER_LIFE_OBJECT));
 
   // Update life counter on fall
-  fallDeath->OnFall.AddListener("update-lives", [this]()
+  fallDeath->OnFall.AddListener([this]()
                                 { UpdateLifeCounter(); });
 
   // Start lives counter
@@ -40,10 +40,10 @@ void CharacterUIManager::Start()
   // Grab heat
   auto heat = fallDeath->worldObject.RequireComponent<Heat>();
 
-  heat->OnHeatChange.AddListener("update-heat-display", [this](float newHeat, float oldHeat)
+  heat->OnHeatChange.AddListener([this](float newHeat, float oldHeat)
                                  { UpdateHeatDisplay(newHeat, oldHeat); });
 
-  fallDeath->OnFall.AddListener("update-heat-display", [this]()
+  fallDeath->OnFall.AddListener([this]()
                                 { UpdateHeatDisplay(0, 0); });
 
   // Start heat display
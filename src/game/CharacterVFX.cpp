@@ -76,7 +76,7 @@ void CharacterVFX::Awake()
     smokeEmitter->StartEmission();
   };
 
-  worldObject.RequireComponent<Heat>()->OnTakeDamage.AddListener("start-smoke-particles", emitSmoke);
+  worldObject.RequireComponent<Heat>()->OnTakeDamage.AddListener(emitSmoke);
 }
 
 void CharacterVFX::PlayDust(Vector2 offset, range<float> angle, range<float> speed)
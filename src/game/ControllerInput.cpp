@@ -57,21 +57,16 @@ void ControllerInput::HandleButtonRelease(SDL_GameControllerButton button)
 
 void ControllerInput::Start()
 {
-  LOCK(weakPlayer, player);
-
-  // This component callback identifier
-  callbackIdentifier = "controller-input-player-" + to_string(player->PlayerId());
-
   // Subscribe to analog movement
-  inputManager.OnControllerLeftAnalog.AddListener(callbackIdentifier, [this](Vector2 direction, shared_ptr<ControllerDevice> controller)
-                                                  { if (controller->GetId() == GetAssociatedControllerId()) HandleAnalogMovement(direction); });
+  inputSubscriptions.push_back(inputManager.OnControllerLeftAnalog.Subscribe([this](Vector2 direction, shared_ptr<ControllerDevice> controller)
+                                                                               { if (controller->GetId() == GetAssociatedControllerId()) HandleAnalogMovement(direction); }));
 
   // Subscribe to analog buttons
-  inputManager.OnControllerButtonPress.AddListener(callbackIdentifier, [this](SDL_GameControllerButton button, shared_ptr<ControllerDevice> controller)
-                                                   { if (controller->GetId() == GetAssociatedControllerId()) HandleButtonPress(button); });
+  inputSubscriptions.push_back(inputManager.OnControllerButtonPress.Subscribe([this](SDL_GameControllerButton button, shared_ptr<ControllerDevice> controller)
+                                                                                { if (controller->GetId() == GetAssociatedControllerId()) HandleButtonPress(button); }));
 
-  inputManager.OnControllerButtonRelease.AddListener(callbackIdentifier, [this](SDL_GameControllerButton button, shared_ptr<ControllerDevice> controller)
-                                                     { if (controller->GetId() == GetAssociatedControllerId()) HandleButtonRelease(button); });
+  inputSubscriptions.push_back(inputManager.OnControllerButtonRelease.Subscribe([this](SDL_GameControllerButton button, shared_ptr<ControllerDevice> controller)
+                                                                                  { if (controller->GetId() == GetAssociatedControllerId()) HandleButtonRelease(button); }));
 }
 
 int ControllerInput::GetAssociatedControllerId() const
@@ -85,7 +80,5 @@ int ControllerInput::GetAssociatedControllerId() const
 
 void ControllerInput::OnBeforeDestroy()
 {
-  inputManager.OnControllerLeftAnalog.RemoveListener(callbackIdentifier);
-  inputManager.OnControllerButtonPress.RemoveListener(callbackIdentifier);
-  inputManager.OnControllerButtonRelease.RemoveListener(callbackIdentifier);
+  inputSubscriptions.clear();
 }
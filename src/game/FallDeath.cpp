@@ -9,8 +9,6 @@
 #include "CharacterStateManager.h"
 #include "ParticleFX.h"
 
-#define RESPAWN_TIMER "respawn"
-
 using namespace std;
 
 const float FallDeath::deathMargin{3};
@@ -33,7 +31,7 @@ FallDeath::FallDeath(GameObject &associatedObject)
 {
   Assert(weakArena.expired() == false, "Failed to find an Arena component");
 
-  sound.AddAudio(SOUND_FALL, "./assets/sounds/battle/fall-burn.mp3");
+  sound.AddAudio(SOUND_FALL, "./assets/sounds/battle/fall-burn.mp3", SoundCategory::Effect, 1);
 }
 
 void FallDeath::Start()
@@ -46,14 +44,9 @@ void FallDeath::Update(float)
 {
   LOCK(weakArena, arena);
 
+  // Respawn is delayed by fall
   if (IsFallen())
-  {
-    // If respawn timer is up, respawn
-    if (worldObject.timer.Get(RESPAWN_TIMER) >= respawnDelay)
-      Respawn();
-
     return;
-  }
 
   // Otherwise, check for death
   auto position = worldObject.GetPosition();
@@ -102,10 +95,15 @@ void FallDeath::Fall()
   // Disable character
   SetCharacterActive(false);
 
+  // Schedule respawn
+  auto respawn = [this]()
+  {
+    Respawn();
+  };
+
   // Discount life
   if (--lives > 0)
-    // Start respawn timer
-    worldObject.timer.Start(RESPAWN_TIMER);
+    respawnToken = worldObject.DelayFunction(respawn, respawnDelay);
 
   // Raise death event
   else
@@ -126,8 +124,8 @@ void FallDeath::Respawn()
 
   fallen = false;
 
-  // Reset timer
-  worldObject.timer.Reset(RESPAWN_TIMER, 0, false);
+  // Cancel scheduled respawn, in case this one wasn't triggered by it
+  worldObject.CancelDelayedFunction(respawnToken);
 
   // Get height
   auto height = worldObject.RequireComponent<Collider>()->DeriveShape()->GetMaxDimension();
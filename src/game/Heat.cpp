@@ -34,20 +34,21 @@ void Heat::Awake()
   auto sound = worldObject.RequireComponent<Sound>();
   weakSound = sound;
 
-  sound->AddAudio(SOUND_PUNCH_2, "./assets/sounds/battle/punches/02.mp3");
-  sound->AddAudio(SOUND_PUNCH_3, "./assets/sounds/battle/punches/03.mp3");
-  sound->AddAudio(SOUND_PUNCH_4, "./assets/sounds/battle/punches/04.mp3");
-  sound->AddAudio(SOUND_PUNCH_5, "./assets/sounds/battle/punches/05.mp3");
-  sound->AddAudio(SOUND_PUNCH_6, "./assets/sounds/battle/punches/06.mp3");
-  sound->AddAudio(SOUND_PUNCH_7, "./assets/sounds/battle/punches/07.mp3");
-  sound->AddAudio(SOUND_PUNCH_8, "./assets/sounds/battle/punches/08.mp3");
-  sound->AddAudio(SOUND_PUNCH_9, "./assets/sounds/battle/punches/09.mp3");
+  punchSamples = {
+      sound->AddAudio(SOUND_PUNCH_2, "./assets/sounds/battle/punches/02.mp3"),
+      sound->AddAudio(SOUND_PUNCH_3, "./assets/sounds/battle/punches/03.mp3"),
+      sound->AddAudio(SOUND_PUNCH_4, "./assets/sounds/battle/punches/04.mp3"),
+      sound->AddAudio(SOUND_PUNCH_5, "./assets/sounds/battle/punches/05.mp3"),
+      sound->AddAudio(SOUND_PUNCH_6, "./assets/sounds/battle/punches/06.mp3"),
+      sound->AddAudio(SOUND_PUNCH_7, "./assets/sounds/battle/punches/07.mp3"),
+      sound->AddAudio(SOUND_PUNCH_8, "./assets/sounds/battle/punches/08.mp3"),
+      sound->AddAudio(SOUND_PUNCH_9, "./assets/sounds/battle/punches/09.mp3")};
 }
 
 void Heat::Start()
 {
   // On death, reset heat
-  worldObject.RequireComponent<FallDeath>()->OnFall.AddListener("reset-heat", [this]()
+  worldObject.RequireComponent<FallDeath>()->OnFall.AddListener([this]()
                                                                 { heat = 0; });
 }
 
@@ -75,30 +76,19 @@ void Heat::TakeDamage(Damage damage)
   if (damage.impulse.magnitude != 0)
   {
     // Play sound
-    Lock(weakSound)->Play(Sample(
-        vector{SOUND_PUNCH_2,
-               SOUND_PUNCH_3,
-               SOUND_PUNCH_4,
-               SOUND_PUNCH_5,
-               SOUND_PUNCH_6,
-               SOUND_PUNCH_7,
-               SOUND_PUNCH_8,
-               SOUND_PUNCH_9}));
+    Lock(weakSound)->Play(punchSamples[RandomRange(0, int(punchSamples.size()))]);
 
     auto playGrunt = [this]()
     {
-      Lock(weakSound)->Play(Sample(
-          vector{
-              SOUND_GRUNT_1,
-              SOUND_GRUNT_2,
-              SOUND_GRUNT_3,
-              SOUND_GRUNT_4,
-              SOUND_GRUNT_5,
-              SOUND_GRUNT_6,
-              SOUND_GRUNT_7,
-              SOUND_GRUNT_8,
-              SOUND_GRUNT_9,
-              SOUND_GRUNT_10}));
+      LOCK(weakSound, sound);
+
+      // Grunts are added by the character, after this is awoken
+      if (gruntSamples.empty())
+        for (auto grunt : {SOUND_GRUNT_1, SOUND_GRUNT_2, SOUND_GRUNT_3, SOUND_GRUNT_4, SOUND_GRUNT_5,
+                           SOUND_GRUNT_6, SOUND_GRUNT_7, SOUND_GRUNT_8, SOUND_GRUNT_9, SOUND_GRUNT_10})
+          gruntSamples.push_back(sound->GetSample(grunt));
+
+      sound->Play(gruntSamples[RandomRange(0, int(gruntSamples.size()))]);
     };
 
     worldObject.DelayFunction(playGrunt, 0.2f);
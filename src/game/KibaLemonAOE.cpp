@@ -50,14 +50,14 @@ void KibaLemonAOE::Awake()
   particles->emitOnStart = false;
 
   // Deactivate on kiba death
-  worldObject.GetParent()->RequireComponent<FallDeath>()->OnFall.AddListener("deactivate-lime-aoe", [this]()
+  worldObject.GetParent()->RequireComponent<FallDeath>()->OnFall.AddListener([this]()
                                                                              { Deactivate(); });
 }
 
 void KibaLemonAOE::OnTriggerCollisionEnter(TriggerCollisionData triggerData)
 {
   // Get character controller
-  auto targetController = Lock(triggerData.weakOther)->worldObject.GetComponent<CharacterController>();
+  auto targetController = triggerData.RequireOther().worldObject.GetComponent<CharacterController>();
 
   // Ignore if not present
   if (targetController == nullptr)
@@ -70,7 +70,7 @@ void KibaLemonAOE::OnTriggerCollisionEnter(TriggerCollisionData triggerData)
 void KibaLemonAOE::OnTriggerCollisionExit(TriggerCollisionData triggerData)
 {
   // Remove target
-  RemoveTarget(Lock(triggerData.weakOther)->worldObject);
+  RemoveTarget(triggerData.RequireOther().worldObject);
 }
 
 void KibaLemonAOE::AddTarget(std::shared_ptr<CharacterController> target)
@@ -46,10 +46,10 @@ MainMenuInput::MainMenuInput(GameObject &associatedObject)
   // Add sounds
   LOCK(weakSound, sound);
 
-  sound->AddAudio(SOUND_HOVER_CHAR, "./assets/sounds/character-hover.mp3");
-  sound->AddAudio(SOUND_SELECT_CHAR, "./assets/sounds/character-select.mp3");
-  sound->AddAudio(SOUND_CONNECT_PLAYER, "./assets/sounds/player-connect.mp3");
-  sound->AddAudio(SOUND_START_BATTLE, "./assets/sounds/battle-start.wav");
+  sound->AddAudio(SOUND_HOVER_CHAR, "./assets/sounds/character-hover.mp3", SoundCategory::Interface, 1);
+  sound->AddAudio(SOUND_SELECT_CHAR, "./assets/sounds/character-select.mp3", SoundCategory::Interface, 1);
+  sound->AddAudio(SOUND_CONNECT_PLAYER, "./assets/sounds/player-connect.mp3", SoundCategory::Interface, 1);
+  sound->AddAudio(SOUND_START_BATTLE, "./assets/sounds/battle-start.wav", SoundCategory::Interface, 1);
 }
 
 void MainMenuInput::Start()
@@ -110,8 +110,6 @@ void MainMenuInput::PlayerStart()
 
 void MainMenuInput::RegisterListeners()
 {
-  callbackIdentifier = "main-menu-input-" + to_string(id);
-
   // Raises stat if enter was pressed
   auto onKeyPress = [this](int key)
   {
@@ -119,7 +117,7 @@ void MainMenuInput::RegisterListeners()
       PlayerStart();
   };
 
-  inputManager.OnKeyPress.AddListener(callbackIdentifier, onKeyPress);
+  inputSubscriptions.push_back(inputManager.OnKeyPress.Subscribe(onKeyPress));
 
   // React to back button hover
   auto backButton = GetScene()->RequireUIObject<UIImage>(BACK_BUTTON_IMAGE);
@@ -145,8 +143,8 @@ void MainMenuInput::RegisterListeners()
     Lock(weakBack)->SetImagePath("./assets/images/character-selection/header/back-button.png");
   };
 
-  backButton->OnUIEvent.AddListener("lighten-on-hover", lightenBackButton);
-  backButton->OnUIEvent.AddListener("darken-on-hover-end", darkenBackButton);
+  backButton->OnUIEvent.AddListener(lightenBackButton);
+  backButton->OnUIEvent.AddListener(darkenBackButton);
 
   // Return to first screen when it's clicked
   auto returnScreen = [this](shared_ptr<UIEvent> event)
@@ -157,7 +155,7 @@ void MainMenuInput::RegisterListeners()
     Lock(weakAnimationHandler)->PanContent(0);
   };
 
-  backButton->OnUIEvent.AddListener("return-screen-on-click", returnScreen);
+  backButton->OnUIEvent.AddListener(returnScreen);
 
   // For each character option
   for (auto option : GetScene()->RequireUIObject<UIContainer>(OPTIONS_OBJECT)->GetChildren())
@@ -168,8 +166,8 @@ void MainMenuInput::RegisterListeners()
   }
 
   // Cursor click animation
-  inputManager.OnClickDown.AddListener(callbackIdentifier, [this](Vector2)
-                                       { AnimateClick(); });
+  inputSubscriptions.push_back(inputManager.OnClickDown.Subscribe([this](Vector2)
+                                                                  { AnimateClick(); }));
 
   // Subscribe to controller hover
   for (auto selectable : UIControllerSelectable::GetAllInstances())
@@ -200,8 +198,8 @@ void MainMenuInput::RegisterListeners()
       RemovePlayerHover(player);
     };
 
-    selectable->OnControllerSelect.AddListener("menu-select", onControllerHover);
-    selectable->OnControllerUnselect.AddListener("menu-unselect", onControllerUnhover);
+    selectable->OnControllerSelect.AddListener(onControllerHover);
+    selectable->OnControllerUnselect.AddListener(onControllerUnhover);
   }
 
   // Subscribe to controller selection
@@ -232,7 +230,7 @@ void MainMenuInput::RegisterListeners()
     SetPlayerSelect(Lock(playerHovers[player->PlayerId()]), player);
   };
 
-  inputManager.OnControllerButtonPress.AddListener(callbackIdentifier, onButtonPress);
+  inputSubscriptions.push_back(inputManager.OnControllerButtonPress.Subscribe(onButtonPress));
 
   // React to battle start prompt hover
   auto startBattlePrompt = GetScene()->RequireUIObject<UIImage>(START_ARENA_IMAGE);
@@ -250,7 +248,7 @@ void MainMenuInput::RegisterListeners()
       StartBattle();
   };
 
-  startBattlePrompt->OnUIEvent.AddListener("cursor-on-hover", startPromptInteractions);
+  startBattlePrompt->OnUIEvent.AddListener(startPromptInteractions);
 }
 
 void MainMenuInput::SetUpMouseSelection(shared_ptr<UIContainer> option)
@@ -275,7 +273,7 @@ void MainMenuInput::SetUpMouseSelection(shared_ptr<UIContainer> option)
                     RequirePointerCast<BrawlPlayer>(Lock(weakPlayerManager)->GetMainPlayer()));
   };
 
-  option->OnUIEvent.AddListener("detect-selection", handleSelection);
+  option->OnUIEvent.AddListener(handleSelection);
 }
 
 void MainMenuInput::SetUpMouseHover(shared_ptr<UIContainer> option)
@@ -315,8 +313,8 @@ void MainMenuInput::SetUpMouseHover(shared_ptr<UIContainer> option)
     RemovePlayerHover(RequirePointerCast<BrawlPlayer>(Lock(weakPlayerManager)->GetMainPlayer()));
   };
 
-  option->OnUIEvent.AddListener("detect-hover-enter", handleHoverEnter);
-  option->OnUIEvent.AddListener("detect-hover-exit", handleHoverExit);
+  option->OnUIEvent.AddListener(handleHoverEnter);
+  option->OnUIEvent.AddListener(handleHoverExit);
 }
 
 void MainMenuInput::AssociatePlayerBill(shared_ptr<BrawlPlayer> player, shared_ptr<UIContainer> bill)
@@ -563,7 +561,5 @@ void MainMenuInput::StartBattle()
 
 void MainMenuInput::OnBeforeDestroy()
 {
-  inputManager.OnKeyPress.RemoveListener(callbackIdentifier);
-  inputManager.OnClickDown.RemoveListener(callbackIdentifier);
-  inputManager.OnControllerButtonPress.RemoveListener(callbackIdentifier);
+  inputSubscriptions.clear();
 }
@@ -21,6 +21,22 @@ using namespace std;
 
 string MenuScene::GetName() const { return "MenuScene"; }
 
+void MenuScene::DeclareAssets(AssetManifest &manifest)
+{
+  // Splash
+  manifest.images.insert("./assets/images/splash-screen/splash-whole.png");
+  manifest.images.insert("./assets/images/splash-screen/splash.png");
+  manifest.images.insert("./assets/images/splash-screen/subtitle.png");
+  manifest.images.insert("./assets/images/splash-screen/press-start.png");
+  manifest.images.insert("./assets/images/splash-screen/text.png");
+  manifest.sounds.insert("./assets/sounds/title-cut.mp3");
+  manifest.sounds.insert("./assets/sounds/splash-slam.wav");
+  manifest.sounds.insert("./assets/sounds/menu-start.wav");
+
+  // Character selection
+  manifest.images.insert("./assets/images/character-selection/background.png");
+}
+
 void MenuScene::InitializeObjects()
 {
   // Create the main camera
@@ -40,7 +40,7 @@ void Movement::Start()
   originalGravityScale = rigidbody.gravityScale;
 
   // On death, reset fast fall & direction
-  worldObject.RequireComponent<FallDeath>()->OnFall.AddListener("reset-movement", [this]()
+  worldObject.RequireComponent<FallDeath>()->OnFall.AddListener([this]()
                                                                    { SetDirection(0); StopFallFast(); });
 }
 
@@ -43,30 +43,21 @@ void StatefulAnimation::RegisterState(shared_ptr<CharacterState> actionState)
       }
     };
 
-    GetFrame(CancelFrame()).AddCallback(stopCallback);
+    AddCallback(CancelFrame(), stopCallback);
   }
 
   // Also add open sequence frame
   if (OpenSequenceFrame() >= 0)
   {
-    GetFrame(OpenSequenceFrame()).AddCallback([this](WorldObject &)
-                                              { IF_LOCK(weakActionState, actionState)
-                                                           actionState->openToSequence = true; });
+    AddCallback(OpenSequenceFrame(), [this](WorldObject &)
+                { IF_LOCK(weakActionState, actionState)
+                             actionState->openToSequence = true; });
   }
 
   // Subscribe to input release events
   if (actionState != nullptr)
-    actionState->OnActionInputRelease.AddListener("stateful-animation-" + to_string(id), [this]()
-                                                  { OnParentActionInputRelease(); });
-}
-
-StatefulAnimation::~StatefulAnimation()
-{
-  IF_LOCK(weakActionState, actionState)
-  {
-    // Unsubscribe to input release events
-    actionState->OnActionInputRelease.RemoveListener("stateful-animation-" + to_string(id));
-  }
+    inputReleaseSubscription = actionState->OnActionInputRelease.Subscribe([this]()
+                                                                           { OnParentActionInputRelease(); });
 }
 
 int StatefulAnimation::CancelFrame() const { return -1; }
@@ -180,19 +171,20 @@ void AttackAnimation::SetupAttack()
   auto attack = attackObject->AddComponent<Attack>(GetAttackProperties(), GetHitCooldown());
 
   // React to connections
-  attack->OnConnect.AddListener("animation-reaction", [this](shared_ptr<CharacterController> target)
+  attack->OnConnect.AddListener([this](shared_ptr<CharacterController> target)
                                 { OnConnectAttack(target); });
 }
 
 void AttackAnimation::FrameHitbox(AnimationFrame &frame, vector<Circle> hitboxAreas)
 {
-
-  auto callback = [this, frame, hitboxAreas](WorldObject &)
+  auto callback = [frame, hitboxAreas](WorldObject &, Animation &animation)
   {
+    auto &attackAnimation = static_cast<AttackAnimation &>(animation);
+
     if (hitboxAreas.empty())
-      RemoveHitbox();
+      attackAnimation.RemoveHitbox();
     else
-      SetHitbox(frame, hitboxAreas);
+      attackAnimation.SetHitbox(frame, hitboxAreas);
   };
 
   frame.AddCallback(callback);
@@ -280,7 +272,7 @@ InnerLoopAnimation::InnerLoopAnimation(Animator &animator) : AttackAnimation(ani
     }
   };
 
-  OnStop.AddListener("InnerLoopAnimation::OnSequenceStop-check", maybeRaisedOnSequenceStop);
+  sequenceStopCheckListener = OnStop.AddListener(maybeRaisedOnSequenceStop);
 
   if (QuitLoopOnInputRelease())
   {
@@ -302,7 +294,7 @@ InnerLoopAnimation::InnerLoopAnimation(Animator &animator) : AttackAnimation(ani
       else endBehavior = CycleEndBehavior::PlayNext;
     };
 
-    OnCycleEnd.AddListener("update-inner-loop-end-behavior", maybeChangeEndBehavior);
+    endBehaviorListener = OnCycleEnd.AddListener(maybeChangeEndBehavior);
   }
 }
 
@@ -329,6 +321,8 @@ vector<AnimationFrame> InnerLoopAnimation::InitializeFrames()
   throw(runtime_error("Something is very wrong"));
 }
 
+size_t InnerLoopAnimation::GetFramesVariant() const { return size_t(sequencePhase); }
+
 shared_ptr<StatefulAnimation> InnerLoopAnimation::GetNextStateful()
 {
   if (sequencePhase == SequencePhase::PostLoop)
@@ -337,9 +331,9 @@ shared_ptr<StatefulAnimation> InnerLoopAnimation::GetNextStateful()
   // Build an instance of the first phase animation
   auto next = RequirePointerCast<InnerLoopAnimation>(animator.BuildAnimation(Phase1Name()));
 
-  // Give it our listeners
-  next->OnCycleEnd.CopyListeners(OnCycleEnd);
-  next->OnStop.CopyListeners(OnStop);
+  // Give it our listeners (it already has it's own phase listeners)
+  next->OnCycleEnd.CopyListeners(OnCycleEnd, endBehaviorListener);
+  next->OnStop.CopyListeners(OnStop, sequenceStopCheckListener);
   next->OnSequenceStop.CopyListeners(OnSequenceStop);
 
   // Set it accordingly
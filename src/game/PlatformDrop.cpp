@@ -10,7 +10,7 @@ PlatformDrop::PlatformDrop(GameObject &associatedObject, shared_ptr<Rigidbody> b
   auto playerInput = body->worldObject.RequireComponent<PlayerInput>();
 
   // Subscribe to fast falling, which is when we should whitelist platforms
-  playerInput->OnFastFall.AddListener("whitelist-platform-effectors", [this]()
+  playerInput->OnFastFall.AddListener([this]()
                                       { WhitelistPlatforms(); });
 }
 
@@ -33,19 +33,19 @@ void PlatformDrop::WhitelistPlatforms()
 
 void PlatformDrop::OnTriggerCollisionEnter(TriggerCollisionData triggerData)
 {
-  LOCK(triggerData.weakOther, other);
+  auto &other = triggerData.RequireOther();
 
   // Register this platform as in range
-  auto platform = other->worldObject.RequireComponent<PlatformEffector>();
+  auto platform = other.worldObject.RequireComponent<PlatformEffector>();
   platformsInRange[platform->id] = platform;
 }
 
 void PlatformDrop::OnTriggerCollisionExit(TriggerCollisionData triggerData)
 {
-  LOCK(triggerData.weakOther, other);
+  auto &other = triggerData.RequireOther();
 
   // Get platform
-  auto platform = other->worldObject.RequireComponent<PlatformEffector>();
+  auto platform = other.worldObject.RequireComponent<PlatformEffector>();
 
   // Get body
   LOCK(weakBody, body);
@@ -11,7 +11,7 @@ PlayerInput::PlayerInput(GameObject &associatedObject)
     SetDirection({0, 0});
   };
 
-  worldObject.RequireComponent<FallDeath>()->OnFall.AddListener("reset-movement-direction", reset);
+  worldObject.RequireComponent<FallDeath>()->OnFall.AddListener(reset);
 }
 
 void PlayerInput::SetDirection(Vector2 direction)
@@ -90,17 +90,14 @@ ShakeEffect::ShakeEffect(shared_ptr<WorldObject> target,
   originalSpriteOffset = renderer->GetOffset();
 
   // Keep it updated
-  renderer->OnSetOffset.AddListener("shake-effect-" + to_string(target->id), [this](Vector2 newOffset)
-                                    { if (ignoreNewOffsetEvent == false) originalSpriteOffset = newOffset; });
+  offsetSubscription = renderer->OnSetOffset.Subscribe([this](Vector2 newOffset)
+                                                       { if (ignoreNewOffsetEvent == false) originalSpriteOffset = newOffset; });
 }
 
 ShakeEffect::~ShakeEffect()
 {
-  IF_LOCK(weakRenderer, renderer)
-  {
-    // Clean up listener
-    renderer->OnSetOffset.RemoveListener("shake-effect-" + to_string(renderer->worldObject.id));
-  }
+  // Clean up listener
+  offsetSubscription.Cancel();
 
   // Reset any modifications
   Reset();
@@ -50,9 +50,9 @@ SplashAnimation::SplashAnimation(GameObject &associatedObject)
   // Register sounds
   LOCK(weakSound, sound);
 
-  sound->AddAudio(SOUND_CUT, "./assets/sounds/title-cut.mp3");
-  sound->AddAudio(SOUND_SLAM, "./assets/sounds/splash-slam.wav");
-  sound->AddAudio(SOUND_START, "./assets/sounds/menu-start.wav");
+  sound->AddAudio(SOUND_CUT, "./assets/sounds/title-cut.mp3", SoundCategory::Interface, 1);
+  sound->AddAudio(SOUND_SLAM, "./assets/sounds/splash-slam.wav", SoundCategory::Interface, 1);
+  sound->AddAudio(SOUND_START, "./assets/sounds/menu-start.wav", SoundCategory::Interface, 1);
 }
 
 void SplashAnimation::Start()